@@ -38,9 +38,81 @@ const TRACE_TAG_REACT_APPS = 1 << 17;
 
 const DEBUG_INFO_LIMIT = 32;
 
+// Layout of the queue flushed to native in the binary format, see
+// `encodeBinaryQueue`.
+const BINARY_QUEUE_VERSION = 1;
+const BINARY_ARGUMENT_NULL = 0;
+const BINARY_ARGUMENT_BOOLEAN = 1;
+const BINARY_ARGUMENT_NUMBER = 2;
+const BINARY_ARGUMENT_STRING = 3;
+const BINARY_ARGUMENT_COMPLEX = 4;
+
+type LegacyQueue = [Array<number>, Array<number>, Array<mixed>, number];
+type BinaryQueue = [ArrayBuffer, Array<string>, Array<mixed>];
+type FlushedQueue = LegacyQueue | BinaryQueue;
+
+/**
+ * Packs the queue into a `Float64Array` so that native can read module IDs,
+ * method IDs and primitive arguments without converting the whole queue:
+ *
+ *   [version, numberOfCalls, callID,
+ *     (moduleID, methodID, numberOfArguments, (tag, value)*)*]
+ *
+ * Strings are passed separately and `value` is their index in the strings
+ * array. Objects and arrays keep going through the regular conversion: they
+ * are passed in the complex arguments array, which `value` indexes into.
+ */
+function encodeBinaryQueue(queue: LegacyQueue): BinaryQueue {
+  const moduleIDs = queue[MODULE_IDS];
+  const methodIDs = queue[METHOD_IDS];
+  const params = queue[PARAMS];
+
+  let size = 3;
+  for (let i = 0; i < params.length; i++) {
+    // $FlowFixMe[incompatible-use] params of each call are arrays
+    size += 3 + 2 * params[i].length;
+  }
+
+  const batch = new Float64Array(size);
+  const strings = [];
+  const complexArguments = [];
+  batch[0] = BINARY_QUEUE_VERSION;
+  batch[1] = moduleIDs.length;
+  batch[2] = queue[3];
+
+  let offset = 3;
+  for (let i = 0; i < moduleIDs.length; i++) {
+    const args: $ReadOnlyArray<mixed> = (params[i]: $FlowFixMe);
+    batch[offset++] = moduleIDs[i];
+    batch[offset++] = methodIDs[i];
+    batch[offset++] = args.length;
+    for (let j = 0; j < args.length; j++) {
+      const arg = args[j];
+      if (typeof arg === 'number') {
+        batch[offset++] = BINARY_ARGUMENT_NUMBER;
+        batch[offset++] = arg;
+      } else if (typeof arg === 'boolean') {
+        batch[offset++] = BINARY_ARGUMENT_BOOLEAN;
+        batch[offset++] = arg ? 1 : 0;
+      } else if (typeof arg === 'string') {
+        batch[offset++] = BINARY_ARGUMENT_STRING;
+        batch[offset++] = strings.push(arg) - 1;
+      } else if (arg == null) {
+        batch[offset++] = BINARY_ARGUMENT_NULL;
+        batch[offset++] = 0;
+      } else {
+        batch[offset++] = BINARY_ARGUMENT_COMPLEX;
+        batch[offset++] = complexArguments.push(arg) - 1;
+      }
+    }
+  }
+
+  return [batch.buffer, strings, complexArguments];
+}
+
 class MessageQueue {
   _lazyCallableModules: {[key: string]: (void) => {...}, ...};
-  _queue: [number[], number[], mixed[], number];
+  _queue: LegacyQueue;
   _successCallbacks: Map<number, ?(...mixed[]) => void>;
   _failureCallbacks: Map<number, ?(...mixed[]) => void>;
   _callID: number;
@@ -108,7 +180,7 @@ class MessageQueue {
     module: string,
     method: string,
     args: mixed[],
-  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  ): null | FlushedQueue {
     this.__guard(() => {
       this.__callFunction(module, method, args);
     });
@@ -119,7 +191,7 @@ class MessageQueue {
   invokeCallbackAndReturnFlushedQueue(
     cbID: number,
     args: mixed[],
-  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  ): null | FlushedQueue {
     this.__guard(() => {
       this.__invokeCallback(cbID, args);
     });
@@ -127,14 +199,14 @@ class MessageQueue {
     return this.flushedQueue();
   }
 
-  flushedQueue(): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  flushedQueue(): null | FlushedQueue {
     this.__guard(() => {
       this.__callReactNativeMicrotasks();
     });
 
     const queue = this._queue;
     this._queue = [[], [], [], this._callID];
-    return queue[0].length ? queue : null;
+    return queue[0].length ? this.__encodeQueue(queue) : null;
   }
 
   getEventLoopRunningTime(): number {
@@ -317,7 +389,7 @@ class MessageQueue {
       const queue = this._queue;
       this._queue = [[], [], [], this._callID];
       this._lastFlush = now;
-      global.nativeFlushQueueImmediate(queue);
+      global.nativeFlushQueueImmediate(this.__encodeQueue(queue));
     }
     Systrace.counterEvent('pending_js_to_native_queue', this._queue[0].length);
     if (__DEV__ && this.__spy && isFinite(moduleID)) {
@@ -392,6 +464,13 @@ class MessageQueue {
     Systrace.endEvent();
   }
 
+  __encodeQueue(queue: LegacyQueue): FlushedQueue {
+    // Set by native executors which can parse the binary format.
+    return global.nativeSupportsBinaryMethodCallBatches === true
+      ? encodeBinaryQueue(queue)
+      : queue;
+  }
+
   __callFunction(module: string, method: string, args: mixed[]): void {
     this._lastFlush = Date.now();
     this._eventLoopStartTime = this._lastFlush;
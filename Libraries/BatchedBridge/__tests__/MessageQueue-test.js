@@ -52,6 +52,27 @@ describe('MessageQueue', function () {
     assertQueue(flushedQueue, 0, 0, 1, [2]);
   });
 
+  it('should encode native calls in the binary format if supported', () => {
+    global.nativeSupportsBinaryMethodCallBatches = true;
+    try {
+      queue.enqueueNativeCall(0, 1, [2, true, 'foo', null]);
+      queue.enqueueNativeCall(3, 4, [{bar: 'baz'}]);
+      const [buffer, strings, complexArguments] = queue.flushedQueue();
+      // [version, numberOfCalls, callID,
+      //   (moduleID, methodID, numberOfArguments, (tag, value)*)*]
+      // prettier-ignore
+      expect(Array.from(new Float64Array(buffer))).toEqual([
+        1, 2, 0,
+        0, 1, 4, 2, 2, 1, 1, 3, 0, 0, 0,
+        3, 4, 1, 4, 0,
+      ]);
+      expect(strings).toEqual(['foo']);
+      expect(complexArguments).toEqual([{bar: 'baz'}]);
+    } finally {
+      delete global.nativeSupportsBinaryMethodCallBatches;
+    }
+  });
+
   it('should call a local function with the function name', () => {
     MessageQueueTestModule.testHook2 = jest.fn();
     expect(MessageQueueTestModule.testHook2.mock.calls.length).toEqual(0);
@@ -254,6 +254,28 @@ public class CatalystInstanceImpl implements CatalystInstance {
 
   private native void jniRegisterSegment(int segmentId, String path);
 
+  /**
+   * Prefetches the modules of the RAM bundles loaded afterwards which are required at startup,
+   * from a trace returned by {@link #finishRAMBundleStartupTrace()} on a previous run (may be
+   * empty), and starts recording the modules which they require during this run. Must be called
+   * before {@link #runJSBundle()}.
+   */
+  public void setRAMBundleStartupTrace(String startupTrace) {
+    jniSetRAMBundleStartupTrace(startupTrace);
+  }
+
+  /**
+   * Stops recording the modules required by RAM bundles, e.g. once the first screen is rendered,
+   * and returns them as a trace to persist for the next run.
+   */
+  public String finishRAMBundleStartupTrace() {
+    return jniFinishRAMBundleStartupTrace();
+  }
+
+  private native void jniSetRAMBundleStartupTrace(String startupTrace);
+
+  private native String jniFinishRAMBundleStartupTrace();
+
   private native void jniLoadScriptFromAssets(
       AssetManager assetManager, String assetURL, boolean loadSynchronously);
 
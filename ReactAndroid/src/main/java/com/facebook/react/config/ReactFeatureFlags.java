@@ -137,6 +137,13 @@ public class ReactFeatureFlags {
    */
   public static boolean enableCppPropsIteratorSetter = false;
 
+  /**
+   * Keep the raw props of components which are not mounted from typed props (all components but
+   * View with MapBuffer props) serialized as JSON in C++, rather than as folly::dynamic objects
+   * (this flag is not used in Java).
+   */
+  public static boolean enableCppRawPropsSerialization = false;
+
   /**
    * Allow Differentiator.cpp and FabricMountingManager.cpp to generate a RemoveDeleteTree mega-op.
    */
@@ -79,6 +79,8 @@ public class Binding {
 
   public native void driveCxxAnimations();
 
+  public native void mountPendingTransactionChunks();
+
   public native ReadableNativeMap getInspectorDataForInstance(
       EventEmitterWrapper eventEmitterWrapper);
 
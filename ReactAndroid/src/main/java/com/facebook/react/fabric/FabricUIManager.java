@@ -188,6 +188,8 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
 
   private boolean mDriveCxxAnimations = false;
 
+  private volatile boolean mHasPendingMountingChunks = false;
+
   private long mDispatchViewUpdatesTime = 0l;
   private long mCommitStartTime = 0l;
   private long mLayoutTime = 0l;
@@ -768,6 +770,20 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
     return new IntBufferBatchMountItem(rootTag, intBuffer, objBuffer, commitNumber);
   }
 
+  /**
+   * Schedules a chunk of a mounting transaction which was split into chunks, except the first one:
+   * that one is scheduled by {@link #scheduleMountItem} and reports the telemetry of the commit.
+   */
+  @SuppressWarnings("unused")
+  @AnyThread
+  @ThreadConfined(ANY)
+  private void scheduleMountItemChunk(@NonNull final MountItem mountItem) {
+    mMountItemDispatcher.addMountItem(mountItem);
+    if (UiThreadUtil.isOnUiThread()) {
+      mMountItemDispatcher.tryDispatchMountItems();
+    }
+  }
+
   /**
    * This method enqueues UI operations directly to the UI thread. This might change in the future
    * to enforce execution order using {@link ReactChoreographer.CallbackType}. This method should
@@ -1192,6 +1208,13 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
     mDriveCxxAnimations = false;
   }
 
+  // Called from Binding.cpp when a mounting transaction was split into chunks which are mounted one
+  // per frame.
+  @AnyThread
+  public void onMountingChunksPending() {
+    mHasPendingMountingChunks = true;
+  }
+
   @Override
   public Map<String, Long> getPerformanceCounters() {
     HashMap<String, Long> performanceCounters = new HashMap<>();
@@ -1244,6 +1267,13 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
         mBinding.driveCxxAnimations();
       }
 
+      // Mount the next chunk of every mounting transaction that was split into chunks. The flag is
+      // reset first; Binding.cpp sets it again if there are still more chunks to mount.
+      if (mHasPendingMountingChunks && mBinding != null) {
+        mHasPendingMountingChunks = false;
+        mBinding.mountPendingTransactionChunks();
+      }
+
       try {
         mMountItemDispatcher.dispatchPreMountItems(frameTimeNanos);
         mMountItemDispatcher.tryDispatchMountItems();
@@ -100,6 +100,16 @@ void Binding::driveCxxAnimations() {
   scheduler_->animationTick();
 }
 
+void Binding::mountPendingTransactionChunks() {
+  auto mountingManager =
+      verifyMountingManager("Binding::mountPendingTransactionChunks");
+  if (!mountingManager) {
+    return;
+  }
+
+  mountingManager->executePendingMountingChunks();
+}
+
 #pragma mark - Surface management
 
 void Binding::startSurface(
@@ -455,6 +465,9 @@ void Binding::installFabricUIManager(
       Props::enablePropIteratorSetter;
   BaseTextProps::enablePropIteratorSetter = Props::enablePropIteratorSetter;
 
+  Props::enableRawPropsSerialization =
+      getFeatureFlagValue("enableCppRawPropsSerialization");
+
   // RemoveDelete mega-op
   ShadowViewMutation::PlatformSupportsRemoveDeleteTreeInstruction =
       getFeatureFlagValue("enableRemoveDeleteTreeInstruction");
@@ -648,6 +661,9 @@ void Binding::registerNatives() {
       makeNativeMethod("setConstraints", Binding::setConstraints),
       makeNativeMethod("setPixelDensity", Binding::setPixelDensity),
       makeNativeMethod("driveCxxAnimations", Binding::driveCxxAnimations),
+      makeNativeMethod(
+          "mountPendingTransactionChunks",
+          Binding::mountPendingTransactionChunks),
       makeNativeMethod(
           "uninstallFabricUIManager", Binding::uninstallFabricUIManager),
       makeNativeMethod("registerSurface", Binding::registerSurface),
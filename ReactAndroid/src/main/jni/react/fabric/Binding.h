@@ -125,6 +125,8 @@ class Binding : public jni::HybridClass<Binding>,
 
   void driveCxxAnimations();
 
+  void mountPendingTransactionChunks();
+
   void uninstallFabricUIManager();
 
   // Private member variables
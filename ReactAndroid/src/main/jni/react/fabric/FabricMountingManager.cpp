@@ -19,8 +19,10 @@
 #include <fbjni/fbjni.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
+#include <deque>
 #include <vector>
 
 using namespace facebook::jni;
@@ -50,7 +52,10 @@ FabricMountingManager::FabricMountingManager(
       shouldRememberAllocatedViews_(
           getFeatureFlagValue("shouldRememberAllocatedViews")),
       useMapBufferForViewProps_(config->getBool(
-          "react_native_new_architecture:use_mapbuffer_for_viewprops")) {}
+          "react_native_new_architecture:use_mapbuffer_for_viewprops")),
+      maximumMountingChunkSize_(static_cast<size_t>(std::max<int64_t>(
+          config->getInt64("react_fabric:mounting_chunk_size_android"),
+          0))) {}
 
 void FabricMountingManager::onSurfaceStart(SurfaceId surfaceId) {
   std::lock_guard lock(allocatedViewsMutex_);
@@ -58,8 +63,13 @@ void FabricMountingManager::onSurfaceStart(SurfaceId surfaceId) {
 }
 
 void FabricMountingManager::onSurfaceStop(SurfaceId surfaceId) {
-  std::lock_guard lock(allocatedViewsMutex_);
-  allocatedViewRegistry_.erase(surfaceId);
+  {
+    std::lock_guard lock(allocatedViewsMutex_);
+    allocatedViewRegistry_.erase(surfaceId);
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(commitMutex_);
+  pendingMountItemChunks_.erase(surfaceId);
 }
 
 static inline int getIntBufferSizeForType(CppMountItem::Type mountItemType) {
@@ -250,38 +260,126 @@ local_ref<jobject> FabricMountingManager::getProps(
   if (useMapBufferForViewProps_ &&
       newShadowView.traits.check(ShadowNodeTraits::Trait::View)) {
     react_native_assert(
-        newShadowView.props->rawProps.empty() &&
+        !newShadowView.props->hasRawProps() &&
         "Raw props must be empty when views are using mapbuffer");
-    auto oldProps = oldShadowView.props != nullptr
+    // The props are diffed in place, copying them would cost more than
+    // serializing the diff.
+    static auto const defaultProps = ViewProps{};
+    auto const &oldProps = oldShadowView.props != nullptr
         ? static_cast<ViewProps const &>(*oldShadowView.props)
-        : ViewProps{};
-    auto newProps = static_cast<ViewProps const &>(*newShadowView.props);
+        : defaultProps;
+    auto const &newProps =
+        static_cast<ViewProps const &>(*newShadowView.props);
     return JReadableMapBuffer::createWithContents(
         viewPropsDiff(oldProps, newProps));
   } else {
-    return ReadableNativeMap::newObjectCxxArgs(newShadowView.props->rawProps);
+    return ReadableNativeMap::newObjectCxxArgs(
+        newShadowView.props->getRawProps());
   }
 }
 
 void FabricMountingManager::executeMount(
     MountingCoordinator::Shared const &mountingCoordinator) {
+  if (maximumMountingChunkSize_ == 0) {
+    std::lock_guard<std::recursive_mutex> lock(commitMutex_);
+
+    auto mountingTransaction = mountingCoordinator->pullTransaction();
+
+    if (mountingTransaction.has_value()) {
+      scheduleMountItem(prepareMountItem(*mountingTransaction));
+    }
+    return;
+  }
+
+  // The batches of all chunks are built here, on the committing thread, so
+  // the frame callback on the UI thread only has to hand them out.
+  std::lock_guard<std::mutex> chunksLock(mountingChunksMutex_);
+
+  auto mountItems = std::deque<PreparedMountItem>{};
+  do {
+    auto mountingTransaction =
+        mountingCoordinator->pullTransactionChunk(maximumMountingChunkSize_);
+
+    if (!mountingTransaction.has_value()) {
+      break;
+    }
+
+    mountItems.push_back(prepareMountItem(*mountingTransaction));
+  } while (mountingCoordinator->hasPendingTransactionChunks());
+
+  if (mountItems.empty()) {
+    return;
+  }
+
   std::lock_guard<std::recursive_mutex> lock(commitMutex_);
 
-  SystraceSection s(
-      "FabricUIManagerBinding::schedulerDidFinishTransactionIntBuffer");
-  auto finishTransactionStartTime = telemetryTimePointNow();
+  auto &pendingMountItems =
+      pendingMountItemChunks_[mountingCoordinator->getSurfaceId()];
+
+  // Chunks of previous transactions which are still waiting for their frame
+  // have to be mounted first.
+  if (pendingMountItems.empty()) {
+    scheduleMountItem(mountItems.front());
+    mountItems.pop_front();
+  }
 
-  auto mountingTransaction = mountingCoordinator->pullTransaction();
+  pendingMountItems.insert(
+      pendingMountItems.end(),
+      std::make_move_iterator(mountItems.begin()),
+      std::make_move_iterator(mountItems.end()));
 
-  if (!mountingTransaction.has_value()) {
+  if (pendingMountItems.empty()) {
+    pendingMountItemChunks_.erase(mountingCoordinator->getSurfaceId());
     return;
   }
 
+  requestMountingChunksFrame();
+}
+
+void FabricMountingManager::executePendingMountingChunks() {
+  std::lock_guard<std::recursive_mutex> lock(commitMutex_);
+
+  for (auto iterator = pendingMountItemChunks_.begin();
+       iterator != pendingMountItemChunks_.end();) {
+    auto &pendingMountItems = iterator->second;
+
+    scheduleMountItem(pendingMountItems.front());
+    pendingMountItems.pop_front();
+
+    if (pendingMountItems.empty()) {
+      iterator = pendingMountItemChunks_.erase(iterator);
+    } else {
+      iterator++;
+    }
+  }
+
+  if (!pendingMountItemChunks_.empty()) {
+    requestMountingChunksFrame();
+  }
+}
+
+void FabricMountingManager::requestMountingChunksFrame() {
+  // Asks the mount item dispatcher to call `executePendingMountingChunks` on
+  // the next frame.
+  static auto mountingChunksPendingJNI =
+      jni::findClassStatic(UIManagerJavaDescriptor)
+          ->getMethod<void()>("onMountingChunksPending");
+
+  mountingChunksPendingJNI(javaUIManager_);
+}
+
+FabricMountingManager::PreparedMountItem
+FabricMountingManager::prepareMountItem(
+    MountingTransaction const &mountingTransaction) {
+  SystraceSection s(
+      "FabricUIManagerBinding::schedulerDidFinishTransactionIntBuffer");
+  auto finishTransactionStartTime = telemetryTimePointNow();
+
   auto env = Environment::current();
 
-  auto telemetry = mountingTransaction->getTelemetry();
-  auto surfaceId = mountingTransaction->getSurfaceId();
-  auto &mutations = mountingTransaction->getMutations();
+  auto telemetry = mountingTransaction.getTelemetry();
+  auto surfaceId = mountingTransaction.getSurfaceId();
+  auto &mutations = mountingTransaction.getMutations();
 
   auto revisionNumber = telemetry.getRevisionNumber();
 
@@ -510,33 +608,12 @@ void FabricMountingManager::executeMount(
               jint, jintArray, jtypeArray<jobject>, jint)>(
               "createIntBufferBatchMountItem");
 
-  static auto scheduleMountItem = jni::findClassStatic(UIManagerJavaDescriptor)
-                                      ->getMethod<void(
-                                          JMountItem::javaobject,
-                                          jint,
-                                          jlong,
-                                          jlong,
-                                          jlong,
-                                          jlong,
-                                          jlong,
-                                          jlong,
-                                          jlong)>("scheduleMountItem");
-
   if (batchMountItemIntsSize == 0) {
-    auto finishTransactionEndTime = telemetryTimePointNow();
-
-    scheduleMountItem(
-        javaUIManager_,
+    return {
         nullptr,
-        telemetry.getRevisionNumber(),
-        telemetryTimePointToMilliseconds(telemetry.getCommitStartTime()),
-        telemetryTimePointToMilliseconds(telemetry.getDiffStartTime()),
-        telemetryTimePointToMilliseconds(telemetry.getDiffEndTime()),
-        telemetryTimePointToMilliseconds(telemetry.getLayoutStartTime()),
-        telemetryTimePointToMilliseconds(telemetry.getLayoutEndTime()),
-        telemetryTimePointToMilliseconds(finishTransactionStartTime),
-        telemetryTimePointToMilliseconds(finishTransactionEndTime));
-    return;
+        telemetry,
+        finishTransactionStartTime,
+        telemetryTimePointNow()};
   }
 
   // Allocate the intBuffer and object array, now that we know exact sizes
@@ -818,21 +895,58 @@ void FabricMountingManager::executeMount(
       batchMountItemObjectsSize == 0 ? nullptr : objBufferArray.get(),
       revisionNumber);
 
-  auto finishTransactionEndTime = telemetryTimePointNow();
+  env->DeleteLocalRef(intBufferArray);
+
+  return {
+      make_global(batch),
+      telemetry,
+      finishTransactionStartTime,
+      telemetryTimePointNow()};
+}
+
+void FabricMountingManager::scheduleMountItem(
+    PreparedMountItem const &mountItem) {
+  auto const &telemetry = mountItem.telemetry;
+
+  // The telemetry of a transaction which was split into chunks is only
+  // reported with its first chunk.
+  if (telemetry.getChunkIndex() > 0) {
+    if (!mountItem.batch) {
+      return;
+    }
+
+    static auto scheduleMountItemChunk =
+        jni::findClassStatic(UIManagerJavaDescriptor)
+            ->getMethod<void(JMountItem::javaobject)>(
+                "scheduleMountItemChunk");
+
+    scheduleMountItemChunk(javaUIManager_, mountItem.batch.get());
+    return;
+  }
+
+  static auto scheduleMountItem = jni::findClassStatic(UIManagerJavaDescriptor)
+                                      ->getMethod<void(
+                                          JMountItem::javaobject,
+                                          jint,
+                                          jlong,
+                                          jlong,
+                                          jlong,
+                                          jlong,
+                                          jlong,
+                                          jlong,
+                                          jlong)>("scheduleMountItem");
 
   scheduleMountItem(
       javaUIManager_,
-      batch.get(),
+      mountItem.batch.get(),
       telemetry.getRevisionNumber(),
       telemetryTimePointToMilliseconds(telemetry.getCommitStartTime()),
       telemetryTimePointToMilliseconds(telemetry.getDiffStartTime()),
       telemetryTimePointToMilliseconds(telemetry.getDiffEndTime()),
       telemetryTimePointToMilliseconds(telemetry.getLayoutStartTime()),
       telemetryTimePointToMilliseconds(telemetry.getLayoutEndTime()),
-      telemetryTimePointToMilliseconds(finishTransactionStartTime),
-      telemetryTimePointToMilliseconds(finishTransactionEndTime));
-
-  env->DeleteLocalRef(intBufferArray);
+      telemetryTimePointToMilliseconds(mountItem.finishTransactionStartTime),
+      telemetryTimePointToMilliseconds(mountItem.finishTransactionEndTime));
 }
 
 void FabricMountingManager::preallocateShadowView(
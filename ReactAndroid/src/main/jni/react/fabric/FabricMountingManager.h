@@ -18,7 +18,10 @@
 
 #include <fbjni/fbjni.h>
 
+#include <deque>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace facebook {
 namespace react {
@@ -43,6 +46,12 @@ class FabricMountingManager final {
 
   void executeMount(MountingCoordinator::Shared const &mountingCoordinator);
 
+  /*
+   * Schedules the next prepared chunk of every surface which is being mounted
+   * in chunks. Called by the mount item dispatcher once per frame.
+   */
+  void executePendingMountingChunks();
+
   void dispatchCommand(
       ShadowView const &shadowView,
       std::string const &commandName,
@@ -76,6 +85,48 @@ class FabricMountingManager final {
   bool const shouldRememberAllocatedViews_{false};
   bool const useMapBufferForViewProps_{false};
 
+  /*
+   * When non-zero, every transaction is split into chunks of (roughly) that
+   * many mutations, and every chunk is scheduled as a separate batch in a
+   * separate frame.
+   */
+  size_t const maximumMountingChunkSize_{0};
+
+  /*
+   * A batch built from a transaction (or a chunk of it), ready to be
+   * scheduled on the Java side.
+   */
+  struct PreparedMountItem {
+    jni::global_ref<JMountItem> batch;
+    TransactionTelemetry telemetry;
+    TelemetryTimePoint finishTransactionStartTime;
+    TelemetryTimePoint finishTransactionEndTime;
+  };
+
+  /*
+   * Serializes pulling and preparing chunks, so they are queued in the order
+   * they were pulled.
+   */
+  std::mutex mountingChunksMutex_;
+
+  /*
+   * Prepared chunks waiting for their frame, per surface. Protected by
+   * `commitMutex_`.
+   */
+  std::unordered_map<SurfaceId, std::deque<PreparedMountItem>>
+      pendingMountItemChunks_{};
+
+  PreparedMountItem prepareMountItem(
+      MountingTransaction const &mountingTransaction);
+
+  void scheduleMountItem(PreparedMountItem const &mountItem);
+
+  /*
+   * Makes the mount item dispatcher call `executePendingMountingChunks` on
+   * the next frame.
+   */
+  void requestMountingChunksFrame();
+
   jni::local_ref<jobject> getProps(
       ShadowView const &oldShadowView,
       ShadowView const &newShadowView);
@@ -357,8 +357,8 @@ static inline MapBuffer viewPropsDiff(
 
   if (oldProps.borderStyles != newProps.borderStyles) {
     int value = -1;
-    if (newProps.borderStyles.all.has_value()) {
-      switch (newProps.borderStyles.all.value()) {
+    if (newProps.borderStyles->all.has_value()) {
+      switch (newProps.borderStyles->all.value()) {
         case BorderStyle::Solid:
           value = 0;
           break;
@@ -118,6 +118,12 @@ void CatalystInstanceImpl::registerNatives() {
           "jniSetSourceURL", CatalystInstanceImpl::jniSetSourceURL),
       makeNativeMethod(
           "jniRegisterSegment", CatalystInstanceImpl::jniRegisterSegment),
+      makeNativeMethod(
+          "jniSetRAMBundleStartupTrace",
+          CatalystInstanceImpl::jniSetRAMBundleStartupTrace),
+      makeNativeMethod(
+          "jniFinishRAMBundleStartupTrace",
+          CatalystInstanceImpl::jniFinishRAMBundleStartupTrace),
       makeNativeMethod(
           "jniLoadScriptFromAssets",
           CatalystInstanceImpl::jniLoadScriptFromAssets),
@@ -240,6 +246,19 @@ void CatalystInstanceImpl::jniRegisterSegment(
   instance_->registerBundle((uint32_t)segmentId, path);
 }
 
+void CatalystInstanceImpl::jniSetRAMBundleStartupTrace(
+    const std::string &startupTrace) {
+  ramBundleStartupTrace_ = std::make_shared<RAMBundleStartupTrace>();
+  instance_->setRAMBundleStartupTrace(startupTrace, ramBundleStartupTrace_);
+}
+
+std::string CatalystInstanceImpl::jniFinishRAMBundleStartupTrace() {
+  if (!ramBundleStartupTrace_) {
+    return "";
+  }
+  return ramBundleStartupTrace_->finish();
+}
+
 static ScriptTag getScriptTagFromFile(const char *sourcePath) {
   std::ifstream bundle_stream(sourcePath, std::ios_base::in);
   BundleHeader header;
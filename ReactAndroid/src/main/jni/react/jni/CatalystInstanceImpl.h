@@ -26,6 +26,7 @@ namespace react {
 class Instance;
 class JavaScriptExecutorHolder;
 class NativeArray;
+class RAMBundleStartupTrace;
 
 struct ReactCallback : public jni::JavaClass<ReactCallback> {
   static constexpr auto kJavaDescriptor =
@@ -85,6 +86,19 @@ class CatalystInstanceImpl : public jni::HybridClass<CatalystInstanceImpl> {
    */
   void jniRegisterSegment(int segmentId, const std::string &path);
 
+  /**
+   * Prefetches the startup modules of the RAM bundles loaded afterwards from
+   * `startupTrace` (returned by `jniFinishRAMBundleStartupTrace` on a previous
+   * run, may be empty), and starts recording the modules they require.
+   */
+  void jniSetRAMBundleStartupTrace(const std::string &startupTrace);
+
+  /**
+   * Stops recording the modules required by RAM bundles and returns them, or
+   * an empty string if nothing was recorded.
+   */
+  std::string jniFinishRAMBundleStartupTrace();
+
   void jniLoadScriptFromAssets(
       jni::alias_ref<JAssetManager::javaobject> assetManager,
       const std::string &assetURL,
@@ -113,6 +127,7 @@ class CatalystInstanceImpl : public jni::HybridClass<CatalystInstanceImpl> {
   std::shared_ptr<Instance> instance_;
   std::shared_ptr<ModuleRegistry> moduleRegistry_;
   std::shared_ptr<JMessageQueueThread> moduleMessageQueue_;
+  std::shared_ptr<RAMBundleStartupTrace> ramBundleStartupTrace_;
   jni::global_ref<CallInvokerHolder::javaobject> jsCallInvokerHolder_;
   jni::global_ref<CallInvokerHolder::javaobject> nativeCallInvokerHolder_;
   jni::global_ref<JRuntimeExecutor::javaobject> runtimeExecutor_;
@@ -9,6 +9,9 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
+
+#include <ReactCommon/CallInvokerTask.h>
 
 namespace facebook {
 namespace react {
@@ -21,6 +24,31 @@ class CallInvoker {
  public:
   virtual void invokeAsync(std::function<void()> &&func) = 0;
   virtual void invokeSync(std::function<void()> &&func) = 0;
+
+  /*
+   * Same as `invokeAsync`, but accepts a move-only task. Implementations which
+   * override it schedule small tasks without any heap allocations; the default
+   * implementation falls back to `invokeAsync`.
+   */
+  virtual void invokeAsyncTask(CallInvokerTask &&task) {
+    auto sharedTask = std::make_shared<CallInvokerTask>(std::move(task));
+    invokeAsync([sharedTask]() { (*sharedTask)(); });
+  }
+
+  /*
+   * Schedules several tasks which are run in order in a single turn of the
+   * target thread (instead of one turn per task).
+   */
+  virtual void invokeAsyncBatch(std::vector<CallInvokerTask> &&tasks) {
+    auto sharedTasks =
+        std::make_shared<std::vector<CallInvokerTask>>(std::move(tasks));
+    invokeAsync([sharedTasks]() {
+      for (auto &task : *sharedTasks) {
+        task();
+      }
+    });
+  }
+
   virtual ~CallInvoker() {}
 };
 
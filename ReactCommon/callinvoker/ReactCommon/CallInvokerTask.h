@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A move-only `void()` callable scheduled by `CallInvoker`.
+ * Unlike `std::function`, does not require the callable to be copyable (so
+ * captured arguments can be moved instead of being wrapped in `shared_ptr`s)
+ * and stores callables of up to `kInlineStorageSize` bytes inline, without a
+ * heap allocation. Bigger callables (or callables which can throw on move)
+ * are stored on the heap.
+ */
+class CallInvokerTask final {
+ public:
+  static constexpr std::size_t kInlineStorageSize = 6 * sizeof(void *);
+
+  CallInvokerTask() noexcept = default;
+
+  CallInvokerTask(std::nullptr_t) noexcept {}
+
+  template <
+      typename CallableT,
+      typename = std::enable_if_t<!std::is_same<
+          std::decay_t<CallableT>,
+          CallInvokerTask>::value>>
+  CallInvokerTask(CallableT &&callable) {
+    using Callable = std::decay_t<CallableT>;
+
+    if constexpr (isStoredInline<Callable>()) {
+      new (&storage_) Callable(std::forward<CallableT>(callable));
+      operations_ = &InlineOperations<Callable>::operations;
+    } else {
+      auto pointer = new Callable(std::forward<CallableT>(callable));
+      new (&storage_) Callable *(pointer);
+      operations_ = &HeapOperations<Callable>::operations;
+    }
+  }
+
+  CallInvokerTask(CallInvokerTask &&other) noexcept {
+    moveFrom(other);
+  }
+
+  CallInvokerTask &operator=(CallInvokerTask &&other) noexcept {
+    if (this != &other) {
+      reset();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  CallInvokerTask(CallInvokerTask const &other) = delete;
+  CallInvokerTask &operator=(CallInvokerTask const &other) = delete;
+
+  ~CallInvokerTask() {
+    reset();
+  }
+
+  explicit operator bool() const noexcept {
+    return operations_ != nullptr;
+  }
+
+  /*
+   * Calls the stored callable. Throws `std::bad_function_call` if the task is
+   * empty, same as `std::function`.
+   */
+  void operator()() {
+    if (!operations_) {
+      throw std::bad_function_call();
+    }
+    operations_->invoke(&storage_);
+  }
+
+ private:
+  struct Operations {
+    void (*invoke)(void *storage);
+    /*
+     * Move-constructs the callable into `destination` and destroys the one in
+     * `source`.
+     */
+    void (*relocate)(void *source, void *destination);
+    void (*destroy)(void *storage);
+  };
+
+  template <typename Callable>
+  static constexpr bool isStoredInline() {
+    return sizeof(Callable) <= kInlineStorageSize &&
+        alignof(Callable) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible<Callable>::value;
+  }
+
+  template <typename Callable>
+  struct InlineOperations {
+    static void invoke(void *storage) {
+      (*static_cast<Callable *>(storage))();
+    }
+
+    static void relocate(void *source, void *destination) {
+      auto &callable = *static_cast<Callable *>(source);
+      new (destination) Callable(std::move(callable));
+      callable.~Callable();
+    }
+
+    static void destroy(void *storage) {
+      static_cast<Callable *>(storage)->~Callable();
+    }
+
+    static constexpr Operations operations{&invoke, &relocate, &destroy};
+  };
+
+  template <typename Callable>
+  struct HeapOperations {
+    static Callable *&pointer(void *storage) {
+      return *static_cast<Callable **>(storage);
+    }
+
+    static void invoke(void *storage) {
+      (*pointer(storage))();
+    }
+
+    static void relocate(void *source, void *destination) {
+      new (destination) Callable *(pointer(source));
+    }
+
+    static void destroy(void *storage) {
+      delete pointer(storage);
+    }
+
+    static constexpr Operations operations{&invoke, &relocate, &destroy};
+  };
+
+  void moveFrom(CallInvokerTask &other) noexcept {
+    if (other.operations_) {
+      other.operations_->relocate(&other.storage_, &storage_);
+      operations_ = other.operations_;
+      other.operations_ = nullptr;
+    }
+  }
+
+  void reset() noexcept {
+    if (operations_) {
+      operations_->destroy(&storage_);
+      operations_ = nullptr;
+    }
+  }
+
+  Operations const *operations_{nullptr};
+  std::aligned_storage_t<kInlineStorageSize, alignof(std::max_align_t)>
+      storage_;
+};
+
+} // namespace react
+} // namespace facebook
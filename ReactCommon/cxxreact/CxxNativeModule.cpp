@@ -194,7 +194,8 @@ void CxxNativeModule::invoke(
 #else
         (void)(callId);
 #endif
-        SystraceSection s(method.name.c_str());
+        // Not recorded in the TraceBuffer, which does not copy names.
+        PlatformSystraceSection s(method.name.c_str());
         try {
           method.func(std::move(params), first, second);
         } catch (const facebook::xplat::JsArgumentException &ex) {
@@ -26,9 +26,11 @@
 
 #include <condition_variable>
 #include <exception>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace facebook {
 namespace react {
@@ -137,6 +139,12 @@ void Instance::loadRAMBundle(
     std::unique_ptr<const JSBigString> startupScript,
     std::string startupScriptSourceURL,
     bool loadSynchronously) {
+  if (nextRAMBundleStartupTrace_) {
+    bundleRegistry->recordStartupTrace(nextRAMBundleStartupTrace_);
+  }
+  if (!ramBundleStartupTrace_.empty()) {
+    bundleRegistry->prefetchStartupModules(ramBundleStartupTrace_);
+  }
   if (loadSynchronously) {
     loadBundleSync(
         std::move(bundleRegistry),
@@ -150,6 +158,13 @@ void Instance::loadRAMBundle(
   }
 }
 
+void Instance::setRAMBundleStartupTrace(
+    std::string startupTrace,
+    std::shared_ptr<RAMBundleStartupTrace> nextStartupTrace) {
+  ramBundleStartupTrace_ = std::move(startupTrace);
+  nextRAMBundleStartupTrace_ = std::move(nextStartupTrace);
+}
+
 void Instance::setGlobalVariable(
     std::string propName,
     std::unique_ptr<const JSBigString> jsonValue) {
@@ -241,14 +256,17 @@ std::shared_ptr<CallInvoker> Instance::getDecoratedNativeCallInvoker(
 
 void Instance::JSCallInvoker::setNativeToJsBridgeAndFlushCalls(
     std::weak_ptr<NativeToJsBridge> nativeToJsBridge) {
-  std::lock_guard<std::mutex> guard(m_mutex);
-
-  m_shouldBuffer = false;
-  m_nativeToJsBridge = nativeToJsBridge;
-  while (m_workBuffer.size() > 0) {
-    scheduleAsync(std::move(m_workBuffer.front()));
-    m_workBuffer.pop_front();
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    m_shouldBuffer = false;
+    m_nativeToJsBridge = nativeToJsBridge;
+    if (m_pendingTasks.empty() || !requestDrain()) {
+      return;
+    }
   }
+
+  scheduleDrain();
 }
 
 void Instance::JSCallInvoker::invokeSync(std::function<void()> &&work) {
@@ -258,39 +276,116 @@ void Instance::JSCallInvoker::invokeSync(std::function<void()> &&work) {
 }
 
 void Instance::JSCallInvoker::invokeAsync(std::function<void()> &&work) {
-  std::lock_guard<std::mutex> guard(m_mutex);
-
-  /**
-   * Why is is necessary to queue up async work?
-   *
-   * 1. TurboModuleManager must be created synchronously after the Instance,
-   *    before we load the source code. This is when the NativeModule system
-   *    is initialized. RCTDevLoadingView shows bundle download progress.
-   * 2. TurboModuleManager requires a JS CallInvoker.
-   * 3. The JS CallInvoker requires the NativeToJsBridge, which is created on
-   *    the JS thread in Instance::initializeBridge.
-   *
-   * Therefore, although we don't call invokeAsync before the JS bundle is
-   * executed, this buffering is implemented anyways to ensure that work
-   * isn't discarded.
-   */
-  if (m_shouldBuffer) {
-    m_workBuffer.push_back(std::move(work));
+  invokeAsyncTask(CallInvokerTask{std::move(work)});
+}
+
+void Instance::JSCallInvoker::invokeAsyncTask(CallInvokerTask &&task) {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    /**
+     * Why is is necessary to queue up async work?
+     *
+     * 1. TurboModuleManager must be created synchronously after the Instance,
+     *    before we load the source code. This is when the NativeModule system
+     *    is initialized. RCTDevLoadingView shows bundle download progress.
+     * 2. TurboModuleManager requires a JS CallInvoker.
+     * 3. The JS CallInvoker requires the NativeToJsBridge, which is created on
+     *    the JS thread in Instance::initializeBridge.
+     *
+     * Therefore, although we don't call invokeAsync before the JS bundle is
+     * executed, this buffering is implemented anyways to ensure that work
+     * isn't discarded.
+     */
+    m_pendingTasks.push_back(std::move(task));
+    if (!requestDrain()) {
+      return;
+    }
+  }
+
+  scheduleDrain();
+}
+
+void Instance::JSCallInvoker::invokeAsyncBatch(
+    std::vector<CallInvokerTask> &&tasks) {
+  if (tasks.empty()) {
     return;
   }
 
-  scheduleAsync(std::move(work));
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    if (m_pendingTasks.empty()) {
+      m_pendingTasks = std::move(tasks);
+    } else {
+      m_pendingTasks.insert(
+          m_pendingTasks.end(),
+          std::make_move_iterator(tasks.begin()),
+          std::make_move_iterator(tasks.end()));
+    }
+
+    if (!requestDrain()) {
+      return;
+    }
+  }
+
+  scheduleDrain();
+}
+
+bool Instance::JSCallInvoker::requestDrain() {
+  if (m_shouldBuffer || m_isDrainScheduled) {
+    return false;
+  }
+
+  m_isDrainScheduled = true;
+  return true;
 }
 
-void Instance::JSCallInvoker::scheduleAsync(std::function<void()> &&work) {
+void Instance::JSCallInvoker::scheduleDrain() {
   if (auto strongNativeToJsBridge = m_nativeToJsBridge.lock()) {
     strongNativeToJsBridge->runOnExecutorQueue(
-        [work = std::move(work)](JSExecutor *executor) {
-          work();
-          executor->flush();
+        [weakThis = weak_from_this()](JSExecutor *executor) {
+          if (auto strongThis = weakThis.lock()) {
+            strongThis->drain(executor);
+          }
         });
   }
 }
 
+void Instance::JSCallInvoker::drain(JSExecutor *executor) {
+  auto tasks = std::vector<CallInvokerTask>{};
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    tasks.swap(m_pendingTasks);
+    m_isDrainScheduled = false;
+  }
+
+  SystraceSection s("JSCallInvoker::drain");
+
+  for (auto it = tasks.begin(); it != tasks.end(); ++it) {
+    try {
+      (*it)();
+    } catch (...) {
+      // Tasks scheduled after the failed one must not be lost; they run in
+      // the next turn, ahead of anything scheduled since this drain started.
+      bool shouldScheduleDrain;
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_pendingTasks.insert(
+            m_pendingTasks.begin(),
+            std::make_move_iterator(std::next(it)),
+            std::make_move_iterator(tasks.end()));
+        shouldScheduleDrain = !m_pendingTasks.empty() && requestDrain();
+      }
+      if (shouldScheduleDrain) {
+        scheduleDrain();
+      }
+      throw;
+    }
+  }
+
+  executor->flush();
+}
+
 } // namespace react
 } // namespace facebook
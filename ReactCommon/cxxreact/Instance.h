@@ -8,9 +8,9 @@
 #pragma once
 
 #include <condition_variable>
-#include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <cxxreact/NativeToJsBridge.h>
@@ -31,6 +31,7 @@ class JSExecutorFactory;
 class MessageQueueThread;
 class ModuleRegistry;
 class RAMBundleRegistry;
+class RAMBundleStartupTrace;
 
 struct InstanceCallback {
   virtual ~InstanceCallback() {}
@@ -68,6 +69,14 @@ class RN_EXPORT Instance {
       std::unique_ptr<const JSBigString> startupScript,
       std::string startupScriptSourceURL,
       bool loadSynchronously);
+  // Applies to the RAM bundles loaded afterwards: their startup modules are
+  // prefetched from `startupTrace` (as returned by
+  // `RAMBundleStartupTrace::finish` on a previous run, may be empty), and
+  // the modules they require are recorded into `nextStartupTrace` (may be
+  // null).
+  void setRAMBundleStartupTrace(
+      std::string startupTrace,
+      std::shared_ptr<RAMBundleStartupTrace> nextStartupTrace);
   bool supportsProfiling();
   void setGlobalVariable(
       std::string propName,
@@ -148,23 +157,41 @@ class RN_EXPORT Instance {
   std::shared_ptr<NativeToJsBridge> nativeToJsBridge_;
   std::shared_ptr<ModuleRegistry> moduleRegistry_;
 
+  std::string ramBundleStartupTrace_;
+  std::shared_ptr<RAMBundleStartupTrace> nextRAMBundleStartupTrace_;
+
   std::mutex m_syncMutex;
   std::condition_variable m_syncCV;
   bool m_syncReady = false;
 
-  class JSCallInvoker : public CallInvoker {
+  /**
+   * Pending async work is accumulated and drained in a single turn of the JS
+   * thread (followed by a single `JSExecutor::flush`), instead of scheduling
+   * a separate turn per call.
+   */
+  class JSCallInvoker : public CallInvoker,
+                        public std::enable_shared_from_this<JSCallInvoker> {
    private:
     std::weak_ptr<NativeToJsBridge> m_nativeToJsBridge;
     std::mutex m_mutex;
     bool m_shouldBuffer = true;
-    std::list<std::function<void()>> m_workBuffer;
+    bool m_isDrainScheduled = false;
+    std::vector<CallInvokerTask> m_pendingTasks;
 
-    void scheduleAsync(std::function<void()> &&work);
+    /**
+     * Must be called with `m_mutex` held. Returns `true` if the caller has to
+     * schedule a drain (after releasing the lock).
+     */
+    bool requestDrain();
+    void scheduleDrain();
+    void drain(JSExecutor *executor);
 
    public:
     void setNativeToJsBridgeAndFlushCalls(
         std::weak_ptr<NativeToJsBridge> nativeToJsBridge);
     void invokeAsync(std::function<void()> &&work) override;
+    void invokeAsyncTask(CallInvokerTask &&task) override;
+    void invokeAsyncBatch(std::vector<CallInvokerTask> &&tasks) override;
     void invokeSync(std::function<void()> &&work) override;
   };
 
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include <folly/Exception.h>
 
 #ifndef RN_EXPORT
@@ -107,6 +110,38 @@ class RN_EXPORT JSBigBufferString : public JSBigString {
   size_t m_size;
 };
 
+// Concrete JSBigString implementation which refers to a region of another
+// JSBigString without copying it, and keeps that string alive. The region must
+// be followed by a \0 byte. Used to serve modules out of a (memory-mapped) RAM
+// bundle.
+class RN_EXPORT JSBigStringSlice : public JSBigString {
+ public:
+  JSBigStringSlice(
+      std::shared_ptr<const JSBigString> source,
+      size_t offset,
+      size_t size)
+      : m_source(std::move(source)),
+        m_data(m_source->c_str() + offset),
+        m_size(size) {}
+
+  bool isAscii() const override {
+    return m_source->isAscii();
+  }
+
+  const char *c_str() const override {
+    return m_data;
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::shared_ptr<const JSBigString> m_source;
+  const char *m_data;
+  size_t m_size;
+};
+
 // JSBigString interface implemented by a file-backed mmap region.
 class RN_EXPORT JSBigFileString : public JSBigString {
  public:
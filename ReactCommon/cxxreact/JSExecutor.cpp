@@ -14,6 +14,33 @@
 namespace facebook {
 namespace react {
 
+void ExecutorDelegate::callNativeModules(
+    JSExecutor &executor,
+    std::vector<MethodCall> &&calls,
+    bool isEndOfBatch) {
+  if (calls.empty()) {
+    callNativeModules(executor, folly::dynamic(nullptr), isEndOfBatch);
+    return;
+  }
+
+  auto moduleIds = folly::dynamic::array();
+  auto methodIds = folly::dynamic::array();
+  auto params = folly::dynamic::array();
+  for (auto &call : calls) {
+    moduleIds.push_back(call.moduleId);
+    methodIds.push_back(call.methodId);
+    params.push_back(std::move(call.arguments));
+  }
+  callNativeModules(
+      executor,
+      folly::dynamic::array(
+          std::move(moduleIds),
+          std::move(methodIds),
+          std::move(params),
+          calls.front().callId),
+      isEndOfBatch);
+}
+
 std::string JSExecutor::getSyntheticBundlePath(
     uint32_t bundleId,
     const std::string &bundlePath) {
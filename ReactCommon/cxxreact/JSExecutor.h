@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 
+#include <cxxreact/MethodCall.h>
 #include <cxxreact/NativeModule.h>
 #include <folly/dynamic.h>
 
@@ -39,6 +40,13 @@ class ExecutorDelegate {
       JSExecutor &executor,
       folly::dynamic &&calls,
       bool isEndOfBatch) = 0;
+  // Same as above, for calls the executor already parsed (e.g. from a
+  // binary batch). By default, converts them back to the `folly::dynamic`
+  // representation; delegates should override it to skip the conversion.
+  virtual void callNativeModules(
+      JSExecutor &executor,
+      std::vector<MethodCall> &&calls,
+      bool isEndOfBatch);
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor &executor,
       unsigned int moduleId,
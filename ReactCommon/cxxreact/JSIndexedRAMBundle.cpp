@@ -7,14 +7,32 @@
 
 #include "JSIndexedRAMBundle.h"
 
+#include <folly/Portability.h>
+#include <folly/lang/Bits.h>
+#include <folly/portability/SysMman.h>
+#include <folly/portability/Unistd.h>
 #include <glog/logging.h>
-#include <fstream>
+#include <cstring>
+#include <ios>
 #include <memory>
-#include <sstream>
 
 namespace facebook {
 namespace react {
 
+namespace {
+
+// Magic number, number of entries in the module table and length of the
+// startup code.
+constexpr size_t kHeaderSize = 3 * sizeof(uint32_t);
+
+uint32_t readUInt32(const char *data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return folly::Endian::little(value);
+}
+
+} // namespace
+
 std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
 JSIndexedRAMBundle::buildFactory() {
   return [](const std::string &bundlePath) {
@@ -22,109 +40,124 @@ JSIndexedRAMBundle::buildFactory() {
   };
 }
 
-JSIndexedRAMBundle::JSIndexedRAMBundle(const char *sourcePath) {
-  m_bundle = std::make_unique<std::ifstream>(sourcePath, std::ifstream::binary);
-  if (!m_bundle) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Bundle ", sourcePath, "cannot be opened: ", m_bundle->rdstate()));
-  }
+JSIndexedRAMBundle::JSIndexedRAMBundle(const char *sourcePath)
+    : m_bundle(JSBigFileString::fromPath(sourcePath)), m_isMapped(true) {
   init();
 }
 
 JSIndexedRAMBundle::JSIndexedRAMBundle(
-    std::unique_ptr<const JSBigString> script) {
-  // tmpStream is needed because m_bundle is std::istream type
-  // which has no member 'write'
-  std::unique_ptr<std::stringstream> tmpStream =
-      std::make_unique<std::stringstream>();
-  tmpStream->write(script->c_str(), script->size());
-  m_bundle = std::move(tmpStream);
-  if (!m_bundle) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Bundle from string cannot be opened: ", m_bundle->rdstate()));
-  }
+    std::unique_ptr<const JSBigString> script)
+    : m_bundle(std::move(script)),
+      m_isMapped(
+          dynamic_cast<const JSBigFileString *>(m_bundle.get()) != nullptr) {
   init();
 }
 
 void JSIndexedRAMBundle::init() {
-  // read in magic header, number of entries, and length of the startup section
-  uint32_t header[3];
-  static_assert(
-      sizeof(header) == 12,
-      "header size must exactly match the input file format");
-
-  readBundle(reinterpret_cast<char *>(header), sizeof(header));
-  const size_t numTableEntries = folly::Endian::little(header[1]);
-  const size_t startupCodeSize = folly::Endian::little(header[2]);
-
-  // allocate memory for meta data and lookup table.
-  m_table = ModuleTable(numTableEntries);
-  m_baseOffset = sizeof(header) + m_table.byteLength();
+  const char *data = m_bundle->c_str();
+  const size_t size = m_bundle->size();
+  if (size < kHeaderSize) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
+  }
 
-  // read the lookup table from the file
-  readBundle(
-      reinterpret_cast<char *>(m_table.data.get()), m_table.byteLength());
+  m_numTableEntries = readUInt32(data + sizeof(uint32_t));
+  m_startupCodeSize = readUInt32(data + 2 * sizeof(uint32_t));
+  if (m_numTableEntries > (size - kHeaderSize) / sizeof(ModuleData)) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
+  }
+  m_baseOffset = kHeaderSize + m_numTableEntries * sizeof(ModuleData);
+  if (m_startupCodeSize == 0 || m_baseOffset + m_startupCodeSize > size) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
+  }
 
-  // read the startup code
-  m_startupCode = std::unique_ptr<JSBigBufferString>(
-      new JSBigBufferString{startupCodeSize - 1});
+  // The table is read in place, unless it can't be (on big-endian platforms,
+  // or if the bundle isn't aligned in memory).
+  const char *table = data + kHeaderSize;
+  if (folly::kIsLittleEndian &&
+      reinterpret_cast<uintptr_t>(table) % alignof(ModuleData) == 0) {
+    m_table = reinterpret_cast<const ModuleData *>(table);
+  } else {
+    m_tableCopy = std::make_unique<ModuleData[]>(m_numTableEntries);
+    for (size_t i = 0; i < m_numTableEntries; i++) {
+      const char *entry = table + i * sizeof(ModuleData);
+      m_tableCopy[i] = {readUInt32(entry), readUInt32(entry + 4)};
+    }
+    m_table = m_tableCopy.get();
+  }
 
-  readBundle(m_startupCode->data(), startupCodeSize - 1);
+  // The startup code is evaluated right away.
+  prefetch(0, m_baseOffset + m_startupCodeSize);
 }
 
 JSIndexedRAMBundle::Module JSIndexedRAMBundle::getModule(
     uint32_t moduleId) const {
+  const auto moduleData = getModuleData(moduleId);
+  const size_t offset = m_baseOffset + moduleData->offset;
+  const size_t length = moduleData->length - 1;
+
   Module ret;
   ret.name = folly::to<std::string>(moduleId, ".js");
-  ret.code = getModuleCode(moduleId);
+  if (m_bundle->c_str()[offset + length] == '\0') {
+    ret.source = std::make_unique<JSBigStringSlice>(m_bundle, offset, length);
+  } else {
+    ret.code = std::string(m_bundle->c_str() + offset, length);
+  }
   return ret;
 }
 
 std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getStartupCode() {
-  CHECK(m_startupCode)
-      << "startup code for a RAM Bundle can only be retrieved once";
-  return std::move(m_startupCode);
+  const size_t length = m_startupCodeSize - 1;
+  const char *code = m_bundle->c_str() + m_baseOffset;
+  if (code[length] == '\0') {
+    return std::make_unique<JSBigStringSlice>(m_bundle, m_baseOffset, length);
+  }
+
+  auto startupCode = std::make_unique<JSBigBufferString>(length);
+  std::memcpy(startupCode->data(), code, length);
+  return startupCode;
+}
+
+void JSIndexedRAMBundle::prefetchModules(
+    const std::vector<uint32_t> &moduleIds) const {
+  if (!m_isMapped) {
+    return;
+  }
+  for (auto moduleId : moduleIds) {
+    if (moduleId < m_numTableEntries && m_table[moduleId].length != 0) {
+      prefetch(
+          m_baseOffset + m_table[moduleId].offset, m_table[moduleId].length);
+    }
+  }
 }
 
-std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
-  const auto moduleData = id < m_table.numEntries ? &m_table.data[id] : nullptr;
+const JSIndexedRAMBundle::ModuleData *JSIndexedRAMBundle::getModuleData(
+    const uint32_t id) const {
+  const auto moduleData = id < m_numTableEntries ? &m_table[id] : nullptr;
 
   // entries without associated code have offset = 0 and length = 0
-  const uint32_t length =
-      moduleData ? folly::Endian::little(moduleData->length) : 0;
-  if (length == 0) {
+  if (moduleData == nullptr || moduleData->length == 0) {
     throw std::ios_base::failure(
         folly::to<std::string>("Error loading module", id, "from RAM Bundle"));
   }
-
-  std::string ret(length - 1, '\0');
-  readBundle(
-      &ret.front(),
-      length - 1,
-      m_baseOffset + folly::Endian::little(moduleData->offset));
-  return ret;
-}
-
-void JSIndexedRAMBundle::readBundle(char *buffer, const std::streamsize bytes)
-    const {
-  if (!m_bundle->read(buffer, bytes)) {
-    if (m_bundle->rdstate() & std::ios::eofbit) {
-      throw std::ios_base::failure("Unexpected end of RAM Bundle file");
-    }
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+  if (m_baseOffset + moduleData->offset + moduleData->length >
+      m_bundle->size()) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
   }
+  return moduleData;
 }
 
-void JSIndexedRAMBundle::readBundle(
-    char *buffer,
-    const std::streamsize bytes,
-    const std::ifstream::pos_type position) const {
-  if (!m_bundle->seekg(position)) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+void JSIndexedRAMBundle::prefetch(size_t offset, size_t length) const {
+  if (!m_isMapped || length == 0) {
+    return;
   }
-  readBundle(buffer, bytes);
+  static const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  auto start = reinterpret_cast<uintptr_t>(m_bundle->c_str() + offset);
+  auto pageStart = start & ~(pageSize - 1);
+  // This is only a hint, failures are ignored.
+  madvise(
+      reinterpret_cast<void *>(pageStart),
+      start + length - pageStart,
+      MADV_WILLNEED);
 }
 
 } // namespace react
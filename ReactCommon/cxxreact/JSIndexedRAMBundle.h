@@ -7,8 +7,10 @@
 
 #pragma once
 
-#include <istream>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -20,6 +22,14 @@
 namespace facebook {
 namespace react {
 
+/*
+ * A RAM bundle in the "indexed" format: a header, a table of the offsets and
+ * lengths of the modules, the startup code and the code of the modules.
+ *
+ * Bundles loaded from a file are memory-mapped. The module table, the startup
+ * code and the modules are served as views into the bundle, so modules are
+ * read lazily, by the OS, when they are first evaluated, and are not copied.
+ */
 class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
  public:
   static std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
@@ -34,6 +44,14 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   // Throws std::runtime_error on failure.
   Module getModule(uint32_t moduleId) const override;
 
+  /*
+   * Hints the OS to read the code of the given modules (e.g. the ones known to
+   * be required at startup) into memory ahead of their use. Does nothing for
+   * bundles which are not memory-mapped. Unknown modules are ignored.
+   */
+  void prefetchModules(
+      const std::vector<uint32_t> &moduleIds) const override;
+
  private:
   struct ModuleData {
     uint32_t offset;
@@ -43,30 +61,18 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
       sizeof(ModuleData) == 8,
       "ModuleData must not have any padding and use sizes matching input files");
 
-  struct ModuleTable {
-    size_t numEntries;
-    std::unique_ptr<ModuleData[]> data;
-    ModuleTable() : numEntries(0){};
-    ModuleTable(size_t entries)
-        : numEntries(entries),
-          data(std::unique_ptr<ModuleData[]>(new ModuleData[numEntries])){};
-    size_t byteLength() const {
-      return numEntries * sizeof(ModuleData);
-    }
-  };
-
   void init();
-  std::string getModuleCode(const uint32_t id) const;
-  void readBundle(char *buffer, const std::streamsize bytes) const;
-  void readBundle(
-      char *buffer,
-      const std::streamsize bytes,
-      const std::istream::pos_type position) const;
+  const ModuleData *getModuleData(uint32_t id) const;
+  void prefetch(size_t offset, size_t length) const;
 
-  mutable std::unique_ptr<std::istream> m_bundle;
-  ModuleTable m_table;
+  std::shared_ptr<const JSBigString> m_bundle;
+  bool m_isMapped;
+  const ModuleData *m_table;
+  size_t m_numTableEntries;
+  // Only used if the module table in the bundle isn't suitably aligned.
+  std::unique_ptr<ModuleData[]> m_tableCopy;
   size_t m_baseOffset;
-  std::unique_ptr<JSBigBufferString> m_startupCode;
+  size_t m_startupCodeSize;
 };
 
 } // namespace react
@@ -8,9 +8,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include <cxxreact/JSBigString.h>
 #include <folly/Conv.h>
 
 namespace facebook {
@@ -35,10 +38,19 @@ class JSModulesUnbundle {
   struct Module {
     std::string name;
     std::string code;
+    // When set, the code of the module, which is then not copied into `code`
+    // (e.g. a region of a memory-mapped bundle).
+    std::unique_ptr<const JSBigString> source;
   };
   JSModulesUnbundle() {}
   virtual ~JSModulesUnbundle() {}
   virtual Module getModule(uint32_t moduleId) const = 0;
+  /**
+   * Hints that the given modules are about to be required, so that their
+   * code can be read ahead of time. Does nothing by default.
+   */
+  virtual void prefetchModules(
+      const std::vector<uint32_t> & /*moduleIds*/) const {}
 
  private:
   JSModulesUnbundle(const JSModulesUnbundle &) = delete;
@@ -85,5 +85,87 @@ std::vector<MethodCall> parseMethodCalls(folly::dynamic &&jsonData) {
   return methodCalls;
 }
 
+std::vector<MethodCall> parseMethodCalls(BinaryMethodCallBatch &&batch) {
+  size_t offset = 0;
+  auto next = [&]() -> double {
+    if (offset >= batch.size) {
+      throw std::invalid_argument(folly::to<std::string>(
+          errorPrefix, "binary batch is truncated at ", batch.size));
+    }
+    return batch.values[offset++];
+  };
+  auto nextIndex = [&](size_t count) -> size_t {
+    auto value = next();
+    if (!(value >= 0 && value < count) ||
+        value != static_cast<double>(static_cast<size_t>(value))) {
+      throw std::invalid_argument(folly::to<std::string>(
+          errorPrefix, "invalid index ", value, " of ", count));
+    }
+    return static_cast<size_t>(value);
+  };
+
+  auto version = next();
+  if (version != BinaryMethodCallBatch::kVersion) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "unsupported binary batch version ", version));
+  }
+  // Every call takes at least three values.
+  auto numberOfCalls = nextIndex(batch.size / 3 + 1);
+  auto callId = static_cast<int>(next());
+
+  std::vector<MethodCall> methodCalls;
+  methodCalls.reserve(numberOfCalls);
+  for (size_t i = 0; i < numberOfCalls; i++) {
+    auto moduleId = static_cast<int>(next());
+    auto methodId = static_cast<int>(next());
+    auto numberOfArguments = nextIndex(batch.size / 2 + 1);
+
+    auto arguments = folly::dynamic::array();
+    arguments.reserve(numberOfArguments);
+    for (size_t j = 0; j < numberOfArguments; j++) {
+      auto tag = next();
+      switch (static_cast<int>(tag)) {
+        case BinaryMethodCallBatch::Null:
+          next();
+          arguments.push_back(nullptr);
+          break;
+        case BinaryMethodCallBatch::Bool:
+          arguments.push_back(next() != 0);
+          break;
+        case BinaryMethodCallBatch::Number:
+          arguments.push_back(next());
+          break;
+        case BinaryMethodCallBatch::String:
+          arguments.push_back(
+              std::move(batch.strings[nextIndex(batch.strings.size())]));
+          break;
+        case BinaryMethodCallBatch::Complex:
+          arguments.push_back(std::move(
+              batch.complexArguments[nextIndex(
+                  batch.complexArguments.size())]));
+          break;
+        default:
+          throw std::invalid_argument(folly::to<std::string>(
+              errorPrefix, "invalid argument tag ", tag));
+      }
+    }
+
+    methodCalls.emplace_back(moduleId, methodId, std::move(arguments), callId);
+
+    // only increment callid if contains valid callid as callid is optional
+    callId += (callId != -1) ? 1 : 0;
+  }
+
+  if (offset != batch.size) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix,
+        "binary batch has ",
+        batch.size - offset,
+        " unexpected trailing values"));
+  }
+
+  return methodCalls;
+}
+
 } // namespace react
 } // namespace facebook
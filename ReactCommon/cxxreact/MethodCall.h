@@ -32,5 +32,36 @@ struct MethodCall {
 /// \throws std::invalid_argument
 std::vector<MethodCall> parseMethodCalls(folly::dynamic &&calls);
 
+/*
+ * A batch of calls flushed by `MessageQueue` in the binary format:
+ *
+ *   [version, numberOfCalls, callId,
+ *     (moduleId, methodId, numberOfArguments, (tag, value)*)*]
+ *
+ * `values` points to the memory of the `Float64Array` the batch is packed
+ * into, which is read without copying. String and complex (object or array)
+ * arguments are passed separately; their `value` is an index into `strings`
+ * or `complexArguments` respectively.
+ */
+struct BinaryMethodCallBatch {
+  enum ArgumentTag {
+    Null = 0,
+    Bool = 1,
+    Number = 2,
+    String = 3,
+    Complex = 4,
+  };
+
+  static constexpr int kVersion = 1;
+
+  const double *values;
+  size_t size;
+  std::vector<std::string> strings;
+  std::vector<folly::dynamic> complexArguments;
+};
+
+/// \throws std::invalid_argument
+std::vector<MethodCall> parseMethodCalls(BinaryMethodCallBatch &&batch);
+
 } // namespace react
 } // namespace facebook
@@ -52,15 +52,24 @@ class JsToNativeBridge : public react::ExecutorDelegate {
   }
 
   void callNativeModules(
-      [[maybe_unused]] JSExecutor &executor,
+      JSExecutor &executor,
       folly::dynamic &&calls,
       bool isEndOfBatch) override {
     CHECK(m_registry || calls.empty())
         << "native module calls cannot be completed with no native modules";
+    callNativeModules(
+        executor, parseMethodCalls(std::move(calls)), isEndOfBatch);
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor &executor,
+      std::vector<MethodCall> &&methodCalls,
+      bool isEndOfBatch) override {
+    CHECK(m_registry || methodCalls.empty())
+        << "native module calls cannot be completed with no native modules";
     m_batchHadNativeModuleOrTurboModuleCalls =
-        m_batchHadNativeModuleOrTurboModuleCalls || !calls.empty();
+        m_batchHadNativeModuleOrTurboModuleCalls || !methodCalls.empty();
 
-    std::vector<MethodCall> methodCalls = parseMethodCalls(std::move(calls));
     BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
         (int)methodCalls.size());
 
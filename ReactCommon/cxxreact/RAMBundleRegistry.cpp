@@ -7,13 +7,154 @@
 
 #include "RAMBundleRegistry.h"
 
+#include <folly/Optional.h>
 #include <folly/String.h>
 
+#include <unistd.h>
+
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace facebook {
 namespace react {
 
+namespace {
+
+std::vector<uint32_t> parseStartupTrace(const std::string &startupTrace) {
+  std::vector<uint32_t> moduleIds;
+  uint64_t moduleId = 0;
+  bool hasDigits = false;
+  for (auto c : startupTrace) {
+    if (c >= '0' && c <= '9' && moduleId <= UINT32_MAX) {
+      moduleId = moduleId * 10 + static_cast<uint64_t>(c - '0');
+      hasDigits = true;
+      continue;
+    }
+    if (hasDigits && moduleId <= UINT32_MAX) {
+      moduleIds.push_back(static_cast<uint32_t>(moduleId));
+    }
+    moduleId = 0;
+    hasDigits = false;
+  }
+  if (hasDigits && moduleId <= UINT32_MAX) {
+    moduleIds.push_back(static_cast<uint32_t>(moduleId));
+  }
+  return moduleIds;
+}
+
+} // namespace
+
+std::string RAMBundleStartupTrace::finish() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_isFinished = true;
+  std::string startupTrace;
+  for (auto moduleId : m_moduleIds) {
+    if (!startupTrace.empty()) {
+      startupTrace += ',';
+    }
+    startupTrace += folly::to<std::string>(moduleId);
+  }
+  return startupTrace;
+}
+
+void RAMBundleStartupTrace::record(uint32_t moduleId) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_isFinished && m_recordedModuleIds.insert(moduleId).second) {
+    m_moduleIds.push_back(moduleId);
+  }
+}
+
+/*
+ * Reads the modules of a startup trace on a background thread, and holds them
+ * until they are required.
+ */
+class RAMBundleRegistry::StartupModules {
+ public:
+  StartupModules(
+      const JSModulesUnbundle &bundle,
+      std::vector<uint32_t> moduleIds)
+      : m_bundle(bundle), m_moduleIds(std::move(moduleIds)) {
+    m_thread = std::thread([this] { prefetch(); });
+  }
+
+  ~StartupModules() {
+    m_isCancelled = true;
+    m_thread.join();
+  }
+
+  /*
+   * Returns the module if it was prefetched. Otherwise, the module is not
+   * going to be kept if it is prefetched later.
+   */
+  folly::Optional<JSModulesUnbundle::Module> take(uint32_t moduleId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto module = m_modules.find(moduleId);
+    if (module == m_modules.end()) {
+      m_takenModuleIds.insert(moduleId);
+      return folly::none;
+    }
+    auto result = std::move(module->second);
+    m_modules.erase(module);
+    return result;
+  }
+
+ private:
+  void prefetch() {
+    m_bundle.prefetchModules(m_moduleIds);
+    for (auto moduleId : m_moduleIds) {
+      if (m_isCancelled) {
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_takenModuleIds.count(moduleId) != 0) {
+          continue;
+        }
+      }
+      JSModulesUnbundle::Module module;
+      try {
+        module = m_bundle.getModule(moduleId);
+      } catch (...) {
+        // The bundle changed since the trace was recorded, the JS thread is
+        // going to report the error (if the module is required at all).
+        continue;
+      }
+      touchPages(module);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_takenModuleIds.count(moduleId) == 0) {
+        m_modules.emplace(moduleId, std::move(module));
+      }
+    }
+  }
+
+  /*
+   * Modules of memory-mapped bundles are views into the mapping, which
+   * `getModule` doesn't read. Reads one byte per page so that the page faults
+   * happen on this thread rather than on the JS thread.
+   */
+  static void touchPages(const JSModulesUnbundle::Module &module) {
+    if (!module.source) {
+      return;
+    }
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto data =
+        reinterpret_cast<const volatile char *>(module.source->c_str());
+    auto size = module.source->size();
+    for (size_t offset = 0; offset < size; offset += pageSize) {
+      (void)data[offset];
+    }
+  }
+
+  const JSModulesUnbundle &m_bundle;
+  const std::vector<uint32_t> m_moduleIds;
+  std::mutex m_mutex;
+  std::unordered_map<uint32_t, JSModulesUnbundle::Module> m_modules;
+  std::unordered_set<uint32_t> m_takenModuleIds;
+  std::atomic<bool> m_isCancelled{false};
+  std::thread m_thread;
+};
+
 constexpr uint32_t RAMBundleRegistry::MAIN_BUNDLE_ID;
 
 std::unique_ptr<RAMBundleRegistry> RAMBundleRegistry::singleBundleRegistry(
@@ -35,6 +176,26 @@ RAMBundleRegistry::RAMBundleRegistry(
   m_bundles.emplace(MAIN_BUNDLE_ID, std::move(mainBundle));
 }
 
+RAMBundleRegistry::~RAMBundleRegistry() {
+  // Stops the prefetching before the bundle it reads from goes away.
+  m_startupModules = nullptr;
+}
+
+void RAMBundleRegistry::recordStartupTrace(
+    std::shared_ptr<RAMBundleStartupTrace> startupTrace) {
+  m_startupTrace = std::move(startupTrace);
+}
+
+void RAMBundleRegistry::prefetchStartupModules(
+    const std::string &startupTrace) {
+  auto moduleIds = parseStartupTrace(startupTrace);
+  if (moduleIds.empty()) {
+    return;
+  }
+  m_startupModules = std::make_shared<StartupModules>(
+      *getBundle(MAIN_BUNDLE_ID), std::move(moduleIds));
+}
+
 void RAMBundleRegistry::registerBundle(
     uint32_t bundleId,
     std::string bundlePath) {
@@ -60,13 +221,23 @@ JSModulesUnbundle::Module RAMBundleRegistry::getModule(
     m_bundles.emplace(bundleId, m_factory(bundlePath->second));
   }
 
-  auto module = getBundle(bundleId)->getModule(moduleId);
   if (bundleId == MAIN_BUNDLE_ID) {
-    return module;
+    if (m_startupTrace) {
+      m_startupTrace->record(moduleId);
+    }
+    if (m_startupModules) {
+      if (auto module = m_startupModules->take(moduleId)) {
+        return std::move(*module);
+      }
+    }
+    return getBundle(bundleId)->getModule(moduleId);
   }
+
+  auto module = getBundle(bundleId)->getModule(moduleId);
   return {
       folly::to<std::string>("seg-", bundleId, '_', std::move(module.name)),
       std::move(module.code),
+      std::move(module.source),
   };
 }
 
@@ -10,8 +10,12 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <cxxreact/JSModulesUnbundle.h>
 
@@ -22,6 +26,32 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Records the modules of the main bundle in the order in which they are first
+ * required, e.g. during the startup of the app on a profiling run. The result
+ * is meant to be persisted and passed to
+ * `RAMBundleRegistry::prefetchStartupModules` on later launches.
+ * Thread-safe.
+ */
+class RN_EXPORT RAMBundleStartupTrace {
+ public:
+  /*
+   * Stops recording and returns the trace: the IDs of the modules, separated
+   * by commas.
+   */
+  std::string finish();
+
+ private:
+  friend class RAMBundleRegistry;
+
+  void record(uint32_t moduleId);
+
+  std::mutex m_mutex;
+  bool m_isFinished{false};
+  std::vector<uint32_t> m_moduleIds;
+  std::unordered_set<uint32_t> m_recordedModuleIds;
+};
+
 class RN_EXPORT RAMBundleRegistry {
  public:
   constexpr static uint32_t MAIN_BUNDLE_ID = 0;
@@ -42,14 +72,32 @@ class RN_EXPORT RAMBundleRegistry {
 
   void registerBundle(uint32_t bundleId, std::string bundlePath);
   JSModulesUnbundle::Module getModule(uint32_t bundleId, uint32_t moduleId);
-  virtual ~RAMBundleRegistry(){};
+  virtual ~RAMBundleRegistry();
+
+  /*
+   * Records the modules of the main bundle which are required from now on
+   * into `startupTrace`, until it is finished.
+   */
+  void recordStartupTrace(std::shared_ptr<RAMBundleStartupTrace> startupTrace);
+
+  /*
+   * Reads the modules of a trace recorded by `RAMBundleStartupTrace` (from a
+   * previous run) on a background thread, in order, while the startup code
+   * runs. `getModule` then returns the prefetched modules instead of reading
+   * them again. Unknown modules are ignored.
+   */
+  void prefetchStartupModules(const std::string &startupTrace);
 
  private:
+  class StartupModules;
+
   JSModulesUnbundle *getBundle(uint32_t bundleId) const;
 
   std::function<std::unique_ptr<JSModulesUnbundle>(std::string)> m_factory;
   std::unordered_map<uint32_t, std::string> m_bundlePaths;
   std::unordered_map<uint32_t, std::unique_ptr<JSModulesUnbundle>> m_bundles;
+  std::shared_ptr<RAMBundleStartupTrace> m_startupTrace;
+  std::shared_ptr<StartupModules> m_startupModules;
 };
 
 } // namespace react
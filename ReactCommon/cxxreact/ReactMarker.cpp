@@ -7,6 +7,8 @@
 
 #include "ReactMarker.h"
 
+#include <reactperflogger/TraceBuffer.h>
+
 namespace facebook {
 namespace react {
 namespace ReactMarker {
@@ -23,11 +25,51 @@ LogTaggedMarker logTaggedMarkerBridgeless = nullptr;
 #pragma clang diagnostic pop
 #endif
 
+static const char *getMarkerName(const ReactMarkerId markerId) {
+  switch (markerId) {
+    case NATIVE_REQUIRE_START:
+      return "NATIVE_REQUIRE_START";
+    case NATIVE_REQUIRE_STOP:
+      return "NATIVE_REQUIRE_STOP";
+    case RUN_JS_BUNDLE_START:
+      return "RUN_JS_BUNDLE_START";
+    case RUN_JS_BUNDLE_STOP:
+      return "RUN_JS_BUNDLE_STOP";
+    case CREATE_REACT_CONTEXT_STOP:
+      return "CREATE_REACT_CONTEXT_STOP";
+    case JS_BUNDLE_STRING_CONVERT_START:
+      return "JS_BUNDLE_STRING_CONVERT_START";
+    case JS_BUNDLE_STRING_CONVERT_STOP:
+      return "JS_BUNDLE_STRING_CONVERT_STOP";
+    case NATIVE_MODULE_SETUP_START:
+      return "NATIVE_MODULE_SETUP_START";
+    case NATIVE_MODULE_SETUP_STOP:
+      return "NATIVE_MODULE_SETUP_STOP";
+    case REGISTER_JS_SEGMENT_START:
+      return "REGISTER_JS_SEGMENT_START";
+    case REGISTER_JS_SEGMENT_STOP:
+      return "REGISTER_JS_SEGMENT_STOP";
+    case REACT_INSTANCE_INIT_START:
+      return "REACT_INSTANCE_INIT_START";
+    case REACT_INSTANCE_INIT_STOP:
+      return "REACT_INSTANCE_INIT_STOP";
+  }
+  return "UNKNOWN_MARKER";
+}
+
 void logMarker(const ReactMarkerId markerId) {
-  logTaggedMarker(markerId, nullptr);
+  logMarker(markerId, nullptr);
+}
+
+void logMarker(const ReactMarkerId markerId, const char *tag) {
+  TraceBuffer::logMarker(getMarkerName(markerId), tag);
+  if (logTaggedMarker) {
+    logTaggedMarker(markerId, tag);
+  }
 }
 
 void logMarkerBridgeless(const ReactMarkerId markerId) {
+  TraceBuffer::logMarker(getMarkerName(markerId), nullptr);
   logTaggedMarkerBridgeless(markerId, nullptr);
 }
 
@@ -52,6 +52,15 @@ extern RN_EXPORT LogTaggedMarker logTaggedMarkerBridgeless;
 extern RN_EXPORT void logMarker(const ReactMarkerId markerId); // Bridge only
 extern RN_EXPORT void logMarkerBridgeless(const ReactMarkerId markerId);
 
+/*
+ * Records the marker in the TraceBuffer (if it is enabled, see
+ * reactperflogger/TraceBuffer.h) and forwards it to logTaggedMarker (if it is
+ * set). Prefer it to calling logTaggedMarker directly.
+ */
+extern RN_EXPORT void logMarker(
+    const ReactMarkerId markerId,
+    const char *tag); // Bridge only
+
 } // namespace ReactMarker
 } // namespace react
 } // namespace facebook
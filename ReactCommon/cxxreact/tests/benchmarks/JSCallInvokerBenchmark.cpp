@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/Instance.h>
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSExecutor.h>
+#include <cxxreact/MessageQueueThread.h>
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeToJsBridge.h>
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+int const kNumberOfCallbacks = 100000;
+
+/*
+ * A JS message queue which runs its turns only when the benchmark drains it,
+ * on the benchmark thread.
+ */
+class ManualMessageQueueThread : public MessageQueueThread {
+ public:
+  void runOnQueue(std::function<void()> &&func) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    functions_.push_back(std::move(func));
+  }
+
+  void runOnQueueSync(std::function<void()> &&func) override {
+    func();
+  }
+
+  void quitSynchronous() override {}
+
+  /*
+   * Runs all queued turns (including the ones they queue) and returns their
+   * number.
+   */
+  size_t drain() {
+    auto numberOfTurns = size_t{0};
+    while (true) {
+      auto function = std::function<void()>{};
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (functions_.empty()) {
+          return numberOfTurns;
+        }
+        function = std::move(functions_.front());
+        functions_.pop_front();
+      }
+      function();
+      numberOfTurns++;
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<std::function<void()>> functions_;
+};
+
+/*
+ * Counts flushes, which would call into JS to drain the native module call
+ * queue.
+ */
+class CountingJSExecutor : public JSExecutor {
+ public:
+  explicit CountingJSExecutor(size_t &numberOfFlushes)
+      : numberOfFlushes_(numberOfFlushes) {}
+
+  void initializeRuntime() override {}
+  void loadBundle(std::unique_ptr<const JSBigString>, std::string) override {}
+  void setBundleRegistry(std::unique_ptr<RAMBundleRegistry>) override {}
+  void registerBundle(uint32_t, const std::string &) override {}
+  void callFunction(
+      const std::string &,
+      const std::string &,
+      const folly::dynamic &) override {}
+  void invokeCallback(const double, const folly::dynamic &) override {}
+  void setGlobalVariable(std::string, std::unique_ptr<const JSBigString>)
+      override {}
+  std::string getDescription() override {
+    return "CountingJSExecutor";
+  }
+
+  void flush() override {
+    numberOfFlushes_++;
+  }
+
+ private:
+  size_t &numberOfFlushes_;
+};
+
+class CountingJSExecutorFactory : public JSExecutorFactory {
+ public:
+  std::unique_ptr<JSExecutor> createJSExecutor(
+      std::shared_ptr<ExecutorDelegate>,
+      std::shared_ptr<MessageQueueThread>) override {
+    return std::make_unique<CountingJSExecutor>(numberOfFlushes);
+  }
+
+  size_t numberOfFlushes{0};
+};
+
+/*
+ * An `Instance` with an initialized bridge whose JS queue is drained by the
+ * benchmark.
+ */
+struct BenchmarkInstance {
+  BenchmarkInstance() {
+    instance.initializeBridge(
+        std::make_unique<InstanceCallback>(),
+        executorFactory,
+        jsQueue,
+        std::make_shared<ModuleRegistry>(
+            std::vector<std::unique_ptr<NativeModule>>{}));
+    jsQueue->drain();
+  }
+
+  std::shared_ptr<ManualMessageQueueThread> jsQueue =
+      std::make_shared<ManualMessageQueueThread>();
+  std::shared_ptr<CountingJSExecutorFactory> executorFactory =
+      std::make_shared<CountingJSExecutorFactory>();
+  Instance instance;
+};
+
+struct Callback {
+  void apply(std::tuple<int, double> &&args) {
+    sum += std::get<0>(args) + std::get<1>(args);
+  }
+
+  double sum{0};
+};
+
+void reportCounters(
+    benchmark::State &state,
+    size_t numberOfTurns,
+    size_t numberOfFlushes) {
+  auto iterations = static_cast<double>(state.iterations());
+  state.counters["turns"] = numberOfTurns / iterations;
+  state.counters["flushes"] = numberOfFlushes / iterations;
+  state.SetItemsProcessed(state.iterations() * kNumberOfCallbacks);
+}
+
+} // namespace
+
+/*
+ * What `Instance::JSCallInvoker` and `AsyncCallback::call` used to do: the
+ * arguments are wrapped into a `shared_ptr` (to make the lambda copyable) and
+ * every callback is scheduled on the bridge as a separate turn followed by a
+ * flush.
+ */
+static void jsCallInvokerTurnPerCallback(benchmark::State &state) {
+  auto jsQueue = std::make_shared<ManualMessageQueueThread>();
+  auto executorFactory = std::make_shared<CountingJSExecutorFactory>();
+  auto nativeToJsBridge = std::make_shared<NativeToJsBridge>(
+      executorFactory.get(),
+      std::make_shared<ModuleRegistry>(
+          std::vector<std::unique_ptr<NativeModule>>{}),
+      jsQueue,
+      std::make_shared<InstanceCallback>());
+  auto callback = std::make_shared<Callback>();
+  auto numberOfTurns = size_t{0};
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumberOfCallbacks; i++) {
+      auto argsTuple = std::make_tuple(i, 0.5);
+      std::function<void()> work =
+          [callback,
+           argsPtr = std::make_shared<decltype(argsTuple)>(
+               std::move(argsTuple))] {
+            callback->apply(std::move(*argsPtr));
+          };
+      nativeToJsBridge->runOnExecutorQueue(
+          [work = std::move(work)](JSExecutor *executor) {
+            work();
+            executor->flush();
+          });
+    }
+    numberOfTurns += jsQueue->drain();
+  }
+
+  nativeToJsBridge->destroy();
+  benchmark::DoNotOptimize(callback->sum);
+  reportCounters(state, numberOfTurns, executorFactory->numberOfFlushes);
+}
+BENCHMARK(jsCallInvokerTurnPerCallback)->Unit(benchmark::kMillisecond);
+
+/*
+ * `std::function` callbacks scheduled through the `Instance`'s JS call
+ * invoker, which drains all pending callbacks in a single turn.
+ */
+static void jsCallInvokerFunctions(benchmark::State &state) {
+  auto benchmarkInstance = BenchmarkInstance{};
+  auto jsInvoker = benchmarkInstance.instance.getJSCallInvoker();
+  auto callback = std::make_shared<Callback>();
+  auto numberOfTurns = size_t{0};
+  benchmarkInstance.executorFactory->numberOfFlushes = 0;
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumberOfCallbacks; i++) {
+      auto argsTuple = std::make_tuple(i, 0.5);
+      jsInvoker->invokeAsync(
+          [callback,
+           argsPtr = std::make_shared<decltype(argsTuple)>(
+               std::move(argsTuple))] {
+            callback->apply(std::move(*argsPtr));
+          });
+    }
+    numberOfTurns += benchmarkInstance.jsQueue->drain();
+  }
+
+  benchmark::DoNotOptimize(callback->sum);
+  reportCounters(
+      state, numberOfTurns, benchmarkInstance.executorFactory->numberOfFlushes);
+}
+BENCHMARK(jsCallInvokerFunctions)->Unit(benchmark::kMillisecond);
+
+/*
+ * What `AsyncCallback::call` does now: the arguments are moved into a
+ * move-only `CallInvokerTask` (stored inline, without allocations).
+ */
+static void jsCallInvokerTasks(benchmark::State &state) {
+  auto benchmarkInstance = BenchmarkInstance{};
+  auto jsInvoker = benchmarkInstance.instance.getJSCallInvoker();
+  auto callback = std::make_shared<Callback>();
+  auto numberOfTurns = size_t{0};
+  benchmarkInstance.executorFactory->numberOfFlushes = 0;
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumberOfCallbacks; i++) {
+      jsInvoker->invokeAsyncTask(
+          [callback, argsTuple = std::make_tuple(i, 0.5)]() mutable {
+            callback->apply(std::move(argsTuple));
+          });
+    }
+    numberOfTurns += benchmarkInstance.jsQueue->drain();
+  }
+
+  benchmark::DoNotOptimize(callback->sum);
+  reportCounters(
+      state, numberOfTurns, benchmarkInstance.executorFactory->numberOfFlushes);
+}
+BENCHMARK(jsCallInvokerTasks)->Unit(benchmark::kMillisecond);
+
+/*
+ * Same tasks handed over to the JS call invoker with a single
+ * `invokeAsyncBatch` call.
+ */
+static void jsCallInvokerBatch(benchmark::State &state) {
+  auto benchmarkInstance = BenchmarkInstance{};
+  auto jsInvoker = benchmarkInstance.instance.getJSCallInvoker();
+  auto callback = std::make_shared<Callback>();
+  auto numberOfTurns = size_t{0};
+  benchmarkInstance.executorFactory->numberOfFlushes = 0;
+
+  for (auto _ : state) {
+    auto tasks = std::vector<CallInvokerTask>{};
+    tasks.reserve(kNumberOfCallbacks);
+    for (int i = 0; i < kNumberOfCallbacks; i++) {
+      tasks.emplace_back(
+          [callback, argsTuple = std::make_tuple(i, 0.5)]() mutable {
+            callback->apply(std::move(argsTuple));
+          });
+    }
+    jsInvoker->invokeAsyncBatch(std::move(tasks));
+    numberOfTurns += benchmarkInstance.jsQueue->drain();
+  }
+
+  benchmark::DoNotOptimize(callback->sum);
+  reportCounters(
+      state, numberOfTurns, benchmarkInstance.executorFactory->numberOfFlushes);
+}
+BENCHMARK(jsCallInvokerBatch)->Unit(benchmark::kMillisecond);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
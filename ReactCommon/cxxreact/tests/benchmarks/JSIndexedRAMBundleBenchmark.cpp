@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stdlib.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSIndexedRAMBundle.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+constexpr uint32_t kNumberOfModules = 5000;
+constexpr size_t kModuleSize = 2048;
+
+void appendUInt32(std::string &bundle, uint32_t value) {
+  char bytes[4];
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+  bundle.append(bytes, sizeof(bytes));
+}
+
+// Writes an indexed RAM bundle with `kNumberOfModules` modules of
+// `kModuleSize` bytes to a temporary file, and returns its path.
+const std::string &bundlePath() {
+  static const std::string path = [] {
+    std::string startupCode = "var startup = true;";
+    startupCode += '\0';
+    std::string table;
+    std::string code = startupCode;
+    for (uint32_t moduleId = 0; moduleId < kNumberOfModules; moduleId++) {
+      auto module = "__d(function() {/*" + std::to_string(moduleId);
+      module.resize(kModuleSize - 6, '*');
+      module += "*/});";
+      appendUInt32(table, code.size());
+      appendUInt32(table, module.size() + 1);
+      code += module;
+      code += '\0';
+    }
+
+    std::string bundle;
+    appendUInt32(bundle, 0xFB0BD1E5);
+    appendUInt32(bundle, kNumberOfModules);
+    appendUInt32(bundle, startupCode.size());
+    bundle += table;
+    bundle += code;
+
+    const char *tmpDir = getenv("TMPDIR");
+    std::string tmp = std::string{tmpDir != nullptr ? tmpDir : "/tmp"} +
+        "/bundle.XXXXXX";
+    std::vector<char> tmpBuf{tmp.begin(), tmp.end()};
+    tmpBuf.push_back('\0');
+    const int fd = mkstemp(tmpBuf.data());
+    write(fd, bundle.data(), bundle.size());
+    close(fd);
+    return std::string{tmpBuf.data()};
+  }();
+  return path;
+}
+
+// Reads the whole bundle into memory, as opposed to memory-mapping it.
+std::unique_ptr<const JSBigString> readBundle() {
+  std::ifstream file{bundlePath(), std::ios::binary};
+  std::string contents{
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  auto bundle = std::make_unique<JSBigBufferString>(contents.size());
+  std::memcpy(bundle->data(), contents.data(), contents.size());
+  return bundle;
+}
+
+long residentMemoryKB() {
+  long pages = 0;
+  long residentPages = 0;
+  if (auto statm = fopen("/proc/self/statm", "r")) {
+    if (fscanf(statm, "%ld %ld", &pages, &residentPages) != 2) {
+      residentPages = 0;
+    }
+    fclose(statm);
+  }
+  return residentPages * sysconf(_SC_PAGESIZE) / 1024;
+}
+
+template <typename LoadBundle>
+void loadFirstModule(LoadBundle &loadBundle) {
+  auto bundle = loadBundle();
+  auto startupCode = bundle->getStartupCode();
+  benchmark::DoNotOptimize(startupCode->c_str()[0]);
+  auto module = bundle->getModule(kNumberOfModules / 2);
+  if (module.source) {
+    benchmark::DoNotOptimize(module.source->c_str()[0]);
+  } else {
+    benchmark::DoNotOptimize(module.code[0]);
+  }
+}
+
+// Time to the evaluation of the first module: loading the bundle, getting
+// the startup code and getting the first module that it requires. Also reports
+// how much memory the bundle takes up at that point.
+template <typename LoadBundle>
+void timeToFirstModule(benchmark::State &state, LoadBundle loadBundle) {
+  bundlePath();
+#ifdef __GLIBC__
+  // Returns the memory freed by earlier runs to the OS, so that it isn't
+  // reused without showing up in the resident memory.
+  malloc_trim(0);
+#endif
+  {
+    auto residentMemoryBefore = residentMemoryKB();
+    auto bundle = loadBundle();
+    auto startupCode = bundle->getStartupCode();
+    auto module = bundle->getModule(kNumberOfModules / 2);
+    benchmark::DoNotOptimize(startupCode->c_str()[0]);
+    state.counters["residentKB"] =
+        static_cast<double>(residentMemoryKB() - residentMemoryBefore);
+  }
+
+  for (auto _ : state) {
+    loadFirstModule(loadBundle);
+  }
+}
+
+void timeToFirstModuleWithMappedBundle(benchmark::State &state) {
+  timeToFirstModule(state, [] {
+    return std::make_unique<JSIndexedRAMBundle>(bundlePath().c_str());
+  });
+}
+BENCHMARK(timeToFirstModuleWithMappedBundle);
+
+void timeToFirstModuleWithBundleInMemory(benchmark::State &state) {
+  timeToFirstModule(
+      state, [] { return std::make_unique<JSIndexedRAMBundle>(readBundle()); });
+}
+BENCHMARK(timeToFirstModuleWithBundleInMemory);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <vector>
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSIndexedRAMBundle.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+
+void appendUInt32(std::string &bundle, uint32_t value) {
+  char bytes[4];
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+  bundle.append(bytes, sizeof(bytes));
+}
+
+// Builds an indexed RAM bundle. Empty modules have no entry in the table.
+std::string makeBundle(
+    const std::string &startupCode,
+    const std::vector<std::string> &modules) {
+  std::string code = startupCode + '\0';
+  std::string table;
+  for (const auto &module : modules) {
+    if (module.empty()) {
+      appendUInt32(table, 0);
+      appendUInt32(table, 0);
+      continue;
+    }
+    appendUInt32(table, code.size());
+    appendUInt32(table, module.size() + 1);
+    code += module + '\0';
+  }
+
+  std::string bundle;
+  appendUInt32(bundle, 0xFB0BD1E5);
+  appendUInt32(bundle, modules.size());
+  appendUInt32(bundle, startupCode.size() + 1);
+  return bundle + table + code;
+}
+
+std::string tempFileFromString(const std::string &contents) {
+  const char *tmpDir = getenv("TMPDIR");
+  if (tmpDir == nullptr)
+    tmpDir = "/tmp";
+  std::string tmp{tmpDir};
+  tmp += "/bundle.XXXXXX";
+
+  std::vector<char> tmpBuf{tmp.begin(), tmp.end()};
+  tmpBuf.push_back('\0');
+
+  const int fd = mkstemp(tmpBuf.data());
+  write(fd, contents.data(), contents.size());
+  close(fd);
+
+  return tmpBuf.data();
+}
+
+std::unique_ptr<const JSBigString> bigStringFromString(
+    const std::string &contents) {
+  auto bigString = std::make_unique<JSBigBufferString>(contents.size());
+  std::memcpy(bigString->data(), contents.data(), contents.size());
+  return bigString;
+}
+
+std::string moduleCode(const JSModulesUnbundle::Module &module) {
+  if (module.source) {
+    return std::string(module.source->c_str(), module.source->size());
+  }
+  return module.code;
+}
+
+} // namespace
+
+TEST(JSIndexedRAMBundle, ReadsModulesFromFile) {
+  auto path = tempFileFromString(
+      makeBundle("var startup;", {"var a;", "", "var c = 'c';"}));
+  JSIndexedRAMBundle bundle{path.c_str()};
+
+  auto startupCode = bundle.getStartupCode();
+  EXPECT_EQ("var startup;", std::string(startupCode->c_str()));
+  EXPECT_EQ(12, startupCode->size());
+
+  auto module = bundle.getModule(2);
+  EXPECT_EQ("2.js", module.name);
+  // Served straight from the mapped file.
+  ASSERT_NE(nullptr, module.source);
+  EXPECT_TRUE(module.code.empty());
+  EXPECT_EQ("var c = 'c';", moduleCode(module));
+  EXPECT_EQ('\0', module.source->c_str()[module.source->size()]);
+
+  EXPECT_EQ("var a;", moduleCode(bundle.getModule(0)));
+
+  // Outlives the bundle.
+  auto firstModule = bundle.getModule(0);
+  bundle.prefetchModules({0, 1, 2, 42});
+  unlink(path.c_str());
+  EXPECT_EQ("var a;", moduleCode(firstModule));
+}
+
+TEST(JSIndexedRAMBundle, ReadsModulesFromString) {
+  JSIndexedRAMBundle bundle{
+      bigStringFromString(makeBundle("var startup;", {"var a;", "var b;"}))};
+
+  EXPECT_EQ("var startup;", std::string(bundle.getStartupCode()->c_str()));
+  EXPECT_EQ("var b;", moduleCode(bundle.getModule(1)));
+  EXPECT_EQ("var a;", moduleCode(bundle.getModule(0)));
+}
+
+TEST(JSIndexedRAMBundle, ThrowsForMissingModules) {
+  JSIndexedRAMBundle bundle{
+      bigStringFromString(makeBundle("var startup;", {"var a;", ""}))};
+
+  EXPECT_THROW(bundle.getModule(1), std::ios_base::failure);
+  EXPECT_THROW(bundle.getModule(2), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, ThrowsForTruncatedBundles) {
+  auto contents = makeBundle("var startup;", {"var a;"});
+
+  EXPECT_THROW(
+      JSIndexedRAMBundle{bigStringFromString(contents.substr(0, 8))},
+      std::ios_base::failure);
+  EXPECT_THROW(
+      JSIndexedRAMBundle{bigStringFromString(contents.substr(0, 24))},
+      std::ios_base::failure);
+
+  JSIndexedRAMBundle bundle{
+      bigStringFromString(contents.substr(0, contents.size() - 2))};
+  EXPECT_THROW(bundle.getModule(0), std::ios_base::failure);
+}
@@ -153,3 +153,51 @@ TEST(parseMethodCalls, ParseTwoCalls) {
   auto returnedCalls = parseMethodCalls(folly::parseJson(jsText));
   EXPECT_EQ(2, returnedCalls.size());
 }
+
+TEST(parseMethodCalls, BinaryBatch) {
+  double values[] = {
+      // version, numberOfCalls, callId
+      1, 2, 5,
+      // moduleId, methodId, numberOfArguments, (tag, value)*
+      7, 3, 5, 0, 0, 1, 1, 2, 42.16, 3, 0, 4, 0,
+      8, 4, 0,
+  };
+  auto returnedCalls = parseMethodCalls(BinaryMethodCallBatch{
+      values,
+      sizeof(values) / sizeof(double),
+      {"foo"},
+      {dynamic::object("bar", "baz")}});
+  EXPECT_EQ(2, returnedCalls.size());
+
+  auto &firstCall = returnedCalls[0];
+  EXPECT_EQ(7, firstCall.moduleId);
+  EXPECT_EQ(3, firstCall.methodId);
+  EXPECT_EQ(5, firstCall.callId);
+  EXPECT_EQ(
+      dynamic::array(
+          nullptr, true, 42.16, "foo", dynamic::object("bar", "baz")),
+      firstCall.arguments);
+
+  auto &secondCall = returnedCalls[1];
+  EXPECT_EQ(8, secondCall.moduleId);
+  EXPECT_EQ(4, secondCall.methodId);
+  EXPECT_EQ(6, secondCall.callId);
+  EXPECT_EQ(dynamic::array(), secondCall.arguments);
+}
+
+TEST(parseMethodCalls, InvalidBinaryBatch) {
+  auto parse = [](std::vector<double> values) {
+    parseMethodCalls(
+        BinaryMethodCallBatch{values.data(), values.size(), {}, {}});
+  };
+  // Unsupported version.
+  EXPECT_THROW(parse({2, 0, 0}), std::invalid_argument);
+  // Truncated call.
+  EXPECT_THROW(parse({1, 1, 0, 7, 3}), std::invalid_argument);
+  // Unknown argument tag.
+  EXPECT_THROW(parse({1, 1, 0, 7, 3, 1, 9, 0}), std::invalid_argument);
+  // String index out of bounds.
+  EXPECT_THROW(parse({1, 1, 0, 7, 3, 1, 3, 0}), std::invalid_argument);
+  // Trailing values.
+  EXPECT_THROW(parse({1, 0, 0, 7}), std::invalid_argument);
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/RAMBundleRegistry.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class FakeBundle : public JSModulesUnbundle {
+ public:
+  FakeBundle(
+      uint32_t numberOfModules,
+      std::shared_ptr<std::atomic<size_t>> numberOfReads =
+          std::make_shared<std::atomic<size_t>>(0))
+      : m_numberOfModules(numberOfModules),
+        m_numberOfReads(std::move(numberOfReads)) {}
+
+  Module getModule(uint32_t moduleId) const override {
+    (*m_numberOfReads)++;
+    if (moduleId >= m_numberOfModules) {
+      throw ModuleNotFound(moduleId);
+    }
+    Module module;
+    module.name = folly::to<std::string>(moduleId, ".js");
+    module.code = folly::to<std::string>("module", moduleId);
+    return module;
+  }
+
+ private:
+  uint32_t m_numberOfModules;
+  std::shared_ptr<std::atomic<size_t>> m_numberOfReads;
+};
+
+// Serves the modules as sources, like memory-mapped bundles do.
+class FakeSourceBundle : public JSModulesUnbundle {
+ public:
+  Module getModule(uint32_t moduleId) const override {
+    Module module;
+    module.name = folly::to<std::string>(moduleId, ".js");
+    module.source = std::make_unique<JSBigStdString>(
+        std::string(100000, static_cast<char>('a' + moduleId)));
+    return module;
+  }
+};
+
+} // namespace
+
+TEST(RAMBundleRegistry, RecordsStartupTrace) {
+  auto registry = RAMBundleRegistry::singleBundleRegistry(
+      std::make_unique<FakeBundle>(10));
+  auto startupTrace = std::make_shared<RAMBundleStartupTrace>();
+  registry->recordStartupTrace(startupTrace);
+
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 7);
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 2);
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 7);
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 0);
+  EXPECT_EQ("7,2,0", startupTrace->finish());
+
+  registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 3);
+  EXPECT_EQ("7,2,0", startupTrace->finish());
+}
+
+TEST(RAMBundleRegistry, PrefetchesStartupModules) {
+  auto numberOfReads = std::make_shared<std::atomic<size_t>>(0);
+  auto registry = RAMBundleRegistry::singleBundleRegistry(
+      std::make_unique<FakeBundle>(10, numberOfReads));
+  registry->prefetchStartupModules("7,2,42,,x,0");
+
+  // Modules 7, 2 and 0, and the missing module 42.
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (*numberOfReads < 4 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_EQ(4, *numberOfReads);
+
+  for (uint32_t moduleId : {7, 2, 0}) {
+    auto module =
+        registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, moduleId);
+    EXPECT_EQ(folly::to<std::string>(moduleId, ".js"), module.name);
+    EXPECT_EQ(folly::to<std::string>("module", moduleId), module.code);
+  }
+  EXPECT_EQ(4, *numberOfReads);
+
+  EXPECT_EQ(
+      "module5",
+      registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 5).code);
+  EXPECT_THROW(
+      registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 42),
+      JSModulesUnbundle::ModuleNotFound);
+  // Prefetched modules are only returned once.
+  EXPECT_EQ(
+      "module7",
+      registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 7).code);
+  EXPECT_EQ(7, *numberOfReads);
+}
+
+TEST(RAMBundleRegistry, PrefetchesWhileModulesAreRequired) {
+  auto registry = RAMBundleRegistry::singleBundleRegistry(
+      std::make_unique<FakeBundle>(1000));
+  std::string startupTrace;
+  for (uint32_t moduleId = 0; moduleId < 1000; moduleId++) {
+    startupTrace += folly::to<std::string>(moduleId, ',');
+  }
+  registry->prefetchStartupModules(startupTrace);
+
+  for (uint32_t moduleId = 0; moduleId < 1000; moduleId += 2) {
+    EXPECT_EQ(
+        folly::to<std::string>("module", moduleId),
+        registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, moduleId).code);
+  }
+  // Stops prefetching.
+  registry = nullptr;
+}
+
+TEST(RAMBundleRegistry, IgnoresEmptyStartupTrace) {
+  auto registry = RAMBundleRegistry::singleBundleRegistry(
+      std::make_unique<FakeBundle>(1));
+  registry->prefetchStartupModules("");
+
+  EXPECT_EQ(
+      "module0",
+      registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, 0).code);
+}
+
+TEST(RAMBundleRegistry, PrefetchesStartupModuleSources) {
+  auto registry = RAMBundleRegistry::singleBundleRegistry(
+      std::make_unique<FakeSourceBundle>());
+  registry->prefetchStartupModules("0,1,2");
+
+  for (uint32_t moduleId : {0, 1, 2}) {
+    auto module =
+        registry->getModule(RAMBundleRegistry::MAIN_BUNDLE_ID, moduleId);
+    ASSERT_NE(nullptr, module.source);
+    EXPECT_EQ(
+        std::string(100000, static_cast<char>('a' + moduleId)),
+        std::string(module.source->c_str(), module.source->size()));
+  }
+}
@@ -7,6 +7,7 @@
 
 #include "HermesExecutorFactory.h"
 
+#include <string>
 #include <thread>
 
 #include <cxxreact/MessageQueueThread.h>
@@ -208,8 +209,10 @@ std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
           .getPropertyAsObject(*decoratedRuntime, "prototype");
   errorPrototype.setProperty(*decoratedRuntime, "jsEngine", "hermes");
 
-  return std::make_unique<HermesExecutor>(
+  auto executor = std::make_unique<HermesExecutor>(
       decoratedRuntime, delegate, jsQueue, timeoutInvoker_, runtimeInstaller_);
+  executor->setPreparedJavaScriptCache(preparedJavaScriptCache_);
+  return executor;
 }
 
 ::hermes::vm::RuntimeConfig HermesExecutorFactory::defaultRuntimeConfig() {
@@ -218,6 +221,26 @@ std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
       .build();
 }
 
+std::shared_ptr<PreparedJavaScriptCache>
+HermesExecutorFactory::getPreparedJavaScriptCache(
+    const ::hermes::vm::RuntimeConfig &runtimeConfig) {
+  // The settings of the config which Hermes compiles bundles with. Others
+  // (e.g. of the GC) don't change what `prepareJavaScript` returns.
+  auto runtimeKey = std::string("hermes") +
+      ":generator=" + std::to_string(runtimeConfig.getEnableGenerator()) +
+      ":asyncBreakCheckInEval=" +
+      std::to_string(runtimeConfig.getAsyncBreakCheckInEval()) +
+      ":compilationMode=" +
+      std::to_string(static_cast<int>(runtimeConfig.getCompilationMode()));
+
+  // Bytecode is not compiled when it is prepared, so caching it would only
+  // cost hashing it (and reading all of it from disk).
+  return PreparedJavaScriptCache::getShared(
+      runtimeKey, 2, [](const jsi::Buffer &buffer) {
+        return !HermesRuntime::isHermesBytecode(buffer.data(), buffer.size());
+      });
+}
+
 HermesExecutor::HermesExecutor(
     std::shared_ptr<jsi::Runtime> runtime,
     std::shared_ptr<ExecutorDelegate> delegate,
@@ -9,7 +9,9 @@
 
 #include <hermes/hermes.h>
 #include <jsireact/JSIExecutor.h>
+#include <jsireact/PreparedJavaScriptCache.h>
 #include <functional>
+#include <memory>
 #include <utility>
 
 namespace facebook {
@@ -24,7 +26,9 @@ class HermesExecutorFactory : public JSExecutorFactory {
       ::hermes::vm::RuntimeConfig runtimeConfig = defaultRuntimeConfig())
       : runtimeInstaller_(runtimeInstaller),
         timeoutInvoker_(timeoutInvoker),
-        runtimeConfig_(std::move(runtimeConfig)) {
+        runtimeConfig_(std::move(runtimeConfig)),
+        preparedJavaScriptCache_(
+            getPreparedJavaScriptCache(runtimeConfig_)) {
     assert(timeoutInvoker_ && "Should not have empty timeoutInvoker");
   }
 
@@ -34,10 +38,16 @@ class HermesExecutorFactory : public JSExecutorFactory {
 
  private:
   static ::hermes::vm::RuntimeConfig defaultRuntimeConfig();
+  static std::shared_ptr<PreparedJavaScriptCache> getPreparedJavaScriptCache(
+      const ::hermes::vm::RuntimeConfig &runtimeConfig);
 
   JSIExecutor::RuntimeInstaller runtimeInstaller_;
   JSIScopedTimeoutInvoker timeoutInvoker_;
   ::hermes::vm::RuntimeConfig runtimeConfig_;
+  // Shared by all the runtimes of the process whose config compiles bundles
+  // the same way, so that reloading a bundle doesn't compile it again (even
+  // though the factory itself is created again).
+  std::shared_ptr<PreparedJavaScriptCache> preparedJavaScriptCache_;
 };
 
 class HermesExecutor : public JSIExecutor {
@@ -154,6 +154,10 @@ class JSCRuntime : public jsi::Runtime {
   jsi::PropNameID createPropNameIDFromString(const jsi::String &str) override;
   jsi::PropNameID createPropNameIDFromSymbol(const jsi::Symbol &sym) override;
   std::string utf8(const jsi::PropNameID &) override;
+  void getPropNameIdData(
+      const jsi::PropNameID &sym,
+      void *ctx,
+      void (*cb)(void *ctx, const char *utf8, size_t length)) override;
   bool compare(const jsi::PropNameID &, const jsi::PropNameID &) override;
 
   std::string symbolToString(const jsi::Symbol &) override;
@@ -168,9 +172,17 @@ class JSCRuntime : public jsi::Runtime {
   jsi::String createStringFromAscii(const char *str, size_t length) override;
   jsi::String createStringFromUtf8(const uint8_t *utf8, size_t length) override;
   std::string utf8(const jsi::String &) override;
+  void getStringData(
+      const jsi::String &str,
+      void *ctx,
+      void (*cb)(void *ctx, const char *utf8, size_t length)) override;
 
   jsi::Object createObject() override;
   jsi::Object createObject(std::shared_ptr<jsi::HostObject> ho) override;
+  jsi::Object createObjectWithProperties(
+      const jsi::PropNameID *names,
+      const jsi::Value *values,
+      size_t count) override;
   virtual std::shared_ptr<jsi::HostObject> getHostObject(
       const jsi::Object &) override;
   jsi::HostFunctionType &getHostFunction(const jsi::Function &) override;
@@ -184,6 +196,11 @@ class JSCRuntime : public jsi::Runtime {
   jsi::Value getProperty(const jsi::Object &, const jsi::String &name) override;
   jsi::Value getProperty(const jsi::Object &, const jsi::PropNameID &name)
       override;
+  void getProperties(
+      const jsi::Object &,
+      const jsi::PropNameID *names,
+      jsi::Value *values,
+      size_t count) override;
   bool hasProperty(const jsi::Object &, const jsi::String &name) override;
   bool hasProperty(const jsi::Object &, const jsi::PropNameID &name) override;
   void setPropertyValue(
@@ -345,6 +362,29 @@ std::string JSStringToSTLString(JSStringRef str) {
   return std::string(buffer, actualBytes - 1);
 }
 
+// Calls `cb` with the contents of `str` as UTF-8. JSC only exposes the UTF-16
+// contents of a string, so they are converted, but into a stack buffer for
+// all but long strings, instead of a heap-allocated std::string.
+void getJSStringData(
+    JSStringRef str,
+    void *ctx,
+    void (*cb)(void *ctx, const char *utf8, size_t length)) {
+  std::array<char, 256> stackBuffer;
+  std::unique_ptr<char[]> heapBuffer;
+  char *buffer;
+  size_t maxBytes = JSStringGetMaximumUTF8CStringSize(str);
+  if (maxBytes <= stackBuffer.size()) {
+    buffer = stackBuffer.data();
+  } else {
+    heapBuffer = std::make_unique<char[]>(maxBytes);
+    buffer = heapBuffer.get();
+  }
+  size_t actualBytes = JSStringGetUTF8CString(str, buffer, maxBytes);
+  // See JSStringToSTLString for the handling of invalid UTF-16 data.
+  size_t length = actualBytes ? actualBytes - 1 : strlen(buffer);
+  cb(ctx, buffer, length);
+}
+
 JSStringRef getLengthString() {
   static JSStringRef length = JSStringCreateWithUTF8CString("length");
   return length;
@@ -687,6 +727,13 @@ std::string JSCRuntime::utf8(const jsi::PropNameID &sym) {
   return JSStringToSTLString(stringRef(sym));
 }
 
+void JSCRuntime::getPropNameIdData(
+    const jsi::PropNameID &sym,
+    void *ctx,
+    void (*cb)(void *ctx, const char *utf8, size_t length)) {
+  getJSStringData(stringRef(sym), ctx, cb);
+}
+
 bool JSCRuntime::compare(const jsi::PropNameID &a, const jsi::PropNameID &b) {
   return JSStringIsEqual(stringRef(a), stringRef(b));
 }
@@ -740,10 +787,38 @@ std::string JSCRuntime::utf8(const jsi::String &str) {
   return JSStringToSTLString(stringRef(str));
 }
 
+void JSCRuntime::getStringData(
+    const jsi::String &str,
+    void *ctx,
+    void (*cb)(void *ctx, const char *utf8, size_t length)) {
+  getJSStringData(stringRef(str), ctx, cb);
+}
+
 jsi::Object JSCRuntime::createObject() {
   return createObject(static_cast<JSObjectRef>(nullptr));
 }
 
+jsi::Object JSCRuntime::createObjectWithProperties(
+    const jsi::PropNameID *names,
+    const jsi::Value *values,
+    size_t count) {
+  // Sets the properties directly on the JSObjectRef, before wrapping it into
+  // a jsi::Object.
+  JSObjectRef objRef = JSObjectMake(ctx_, nullptr, nullptr);
+  JSValueRef exc = nullptr;
+  for (size_t i = 0; i < count && !exc; ++i) {
+    JSObjectSetProperty(
+        ctx_,
+        objRef,
+        stringRef(names[i]),
+        valueRef(values[i]),
+        kJSPropertyAttributeNone,
+        &exc);
+  }
+  checkException(exc);
+  return createObject(objRef);
+}
+
 // HostObject details
 namespace detail {
 struct HostObjectProxyBase {
@@ -936,6 +1011,21 @@ jsi::Value JSCRuntime::getProperty(
   return createValue(res);
 }
 
+void JSCRuntime::getProperties(
+    const jsi::Object &obj,
+    const jsi::PropNameID *names,
+    jsi::Value *values,
+    size_t count) {
+  JSObjectRef objRef = objectRef(obj);
+  for (size_t i = 0; i < count; ++i) {
+    JSValueRef exc = nullptr;
+    JSValueRef res =
+        JSObjectGetProperty(ctx_, objRef, stringRef(names[i]), &exc);
+    checkException(exc);
+    values[i] = createValue(res);
+  }
+}
+
 bool JSCRuntime::hasProperty(const jsi::Object &obj, const jsi::String &name) {
   JSObjectRef objRef = objectRef(obj);
   return JSObjectHasProperty(ctx_, objRef, stringRef(name));
@@ -12,6 +12,14 @@
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
 using namespace facebook::jsi;
 
 namespace facebook {
@@ -19,6 +27,176 @@ namespace jsi {
 
 namespace {
 
+// Caches the PropNameIDs used to convert objects with the same keys over and
+// over again (e.g. event payloads and results of native module methods).
+class ConversionCache {
+ public:
+  explicit ConversionCache(size_t capacity) : capacity_(capacity) {}
+
+  // Returns the PropNameIDs of the keys of `object`, in iteration order, or
+  // nullptr if it can't be cached. They stay valid when the shape is evicted
+  // (e.g. while converting the values of `object`).
+  std::shared_ptr<const std::vector<PropNameID>> getPropNameIDs(
+      Runtime& runtime,
+      const folly::dynamic& object) {
+    if (object.empty()) {
+      return nullptr;
+    }
+
+    size_t hash = object.size();
+    for (const auto& key : object.keys()) {
+      if (!key.isString()) {
+        return nullptr;
+      }
+      hash = combineHashes(hash, std::hash<std::string>{}(key.getString()));
+    }
+
+    auto it = dynamicShapes_.find(hash);
+    if (it != dynamicShapes_.end() && it->second->matches(object)) {
+      return {it->second, &it->second->propNameIDs};
+    }
+
+    if (dynamicShapes_.size() >= kMaxShapes) {
+      dynamicShapes_.clear();
+    }
+    // A new shape rather than an update of the colliding one, which may
+    // still be in use.
+    auto shape = std::make_shared<DynamicShape>();
+    for (const auto& key : object.keys()) {
+      shape->keys.push_back(key.getString());
+      shape->propNameIDs.emplace_back(
+          runtime, getPropNameID(runtime, key.getString()));
+    }
+    dynamicShapes_[hash] = shape;
+    return {shape, &shape->propNameIDs};
+  }
+
+  // Returns the keys of an object with the property `names` (as returned by
+  // `getPropertyNames`), along with their PropNameIDs. They are only valid
+  // until the next call.
+  const std::pair<std::vector<std::string>, std::vector<PropNameID>>&
+  getKeys(Runtime& runtime, std::vector<String>&& names) {
+    for (auto& shape : valueShapes_) {
+      if (shape.matches(runtime, names)) {
+        return shape.keys;
+      }
+    }
+
+    auto shape = ValueShape{};
+    for (const auto& name : names) {
+      auto key = name.utf8(runtime);
+      shape.keys.second.emplace_back(runtime, getPropNameID(runtime, key));
+      shape.keys.first.push_back(std::move(key));
+    }
+    shape.names = std::move(names);
+
+    if (valueShapes_.size() < kMaxValueShapes) {
+      valueShapes_.push_back(std::move(shape));
+      return valueShapes_.back().keys;
+    }
+    auto& slot = valueShapes_[nextValueShape_++ % kMaxValueShapes];
+    slot = std::move(shape);
+    return slot.keys;
+  }
+
+ private:
+  static constexpr size_t kMaxShapes = 64;
+  // Matching a JS object against a shape takes a call into the runtime per
+  // property, so fewer of them are kept.
+  static constexpr size_t kMaxValueShapes = 16;
+
+  struct DynamicShape {
+    bool matches(const folly::dynamic& object) const {
+      if (keys.size() != object.size()) {
+        return false;
+      }
+      size_t i = 0;
+      for (const auto& key : object.keys()) {
+        if (key.getString() != keys[i++]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::vector<std::string> keys;
+    std::vector<PropNameID> propNameIDs;
+  };
+
+  struct ValueShape {
+    bool matches(Runtime& runtime, const std::vector<String>& otherNames)
+        const {
+      if (names.size() != otherNames.size()) {
+        return false;
+      }
+      for (size_t i = 0; i < names.size(); i++) {
+        if (!String::strictEquals(runtime, names[i], otherNames[i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::vector<String> names;
+    std::pair<std::vector<std::string>, std::vector<PropNameID>> keys;
+  };
+
+  static size_t combineHashes(size_t seed, size_t hash) {
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+  }
+
+  const PropNameID& getPropNameID(Runtime& runtime, const std::string& key) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->second;
+    }
+
+    if (entries_.size() >= capacity_ && !entries_.empty()) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(key, PropNameID::forUtf8(runtime, key));
+    index_.emplace(entries_.front().first, entries_.begin());
+    return entries_.front().second;
+  }
+
+  size_t capacity_;
+  // Most recently used first; `index_` points into it.
+  std::list<std::pair<std::string, PropNameID>> entries_;
+  std::unordered_map<
+      std::string_view,
+      std::list<std::pair<std::string, PropNameID>>::iterator>
+      index_;
+  std::unordered_map<size_t, std::shared_ptr<DynamicShape>> dynamicShapes_;
+  std::vector<ValueShape> valueShapes_;
+  size_t nextValueShape_{0};
+};
+
+std::atomic<size_t> numberOfConversionCaches{0};
+
+std::mutex& getConversionCachesMutex() {
+  static auto mutex = new std::mutex();
+  return *mutex;
+}
+
+std::unordered_map<Runtime*, std::unique_ptr<ConversionCache>>&
+getConversionCaches() {
+  static auto caches =
+      new std::unordered_map<Runtime*, std::unique_ptr<ConversionCache>>();
+  return *caches;
+}
+
+ConversionCache* getConversionCache(Runtime& runtime) {
+  if (numberOfConversionCaches.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(getConversionCachesMutex());
+  auto& caches = getConversionCaches();
+  auto it = caches.find(&runtime);
+  return it != caches.end() ? it->second.get() : nullptr;
+}
+
 struct FromDynamic {
   FromDynamic(const folly::dynamic* dynArg, Object objArg)
       : dyn(dynArg), obj(std::move(objArg)) {}
@@ -27,10 +205,49 @@ struct FromDynamic {
   Object obj;
 };
 
+bool isContainer(const folly::dynamic& dyn) {
+  return dyn.isArray() || dyn.isObject();
+}
+
+Value valueFromDynamicShallow(
+    Runtime& runtime,
+    ConversionCache* cache,
+    std::vector<FromDynamic>& stack,
+    const folly::dynamic& dyn);
+
+// Creates an object whose values are all primitives, with a single call into
+// the runtime. Returns nullopt if the object's keys aren't cached or one of
+// its values is an object or array.
+std::optional<Object> leafObjectFromDynamic(
+    Runtime& runtime,
+    ConversionCache& cache,
+    const folly::dynamic& dyn) {
+  for (const auto& element : dyn.values()) {
+    if (isContainer(element)) {
+      return std::nullopt;
+    }
+  }
+  auto propNameIDs = cache.getPropNameIDs(runtime, dyn);
+  if (!propNameIDs) {
+    return std::nullopt;
+  }
+
+  std::vector<FromDynamic> unusedStack;
+  std::vector<Value> values;
+  values.reserve(dyn.size());
+  for (const auto& element : dyn.values()) {
+    values.push_back(
+        valueFromDynamicShallow(runtime, nullptr, unusedStack, element));
+  }
+  return Object::createWithProperties(
+      runtime, propNameIDs->data(), values.data(), values.size());
+}
+
 // This converts one element.  If it's a collection, it gets pushed onto
 // the stack for later processing.
 Value valueFromDynamicShallow(
     Runtime& runtime,
+    ConversionCache* cache,
     std::vector<FromDynamic>& stack,
     const folly::dynamic& dyn) {
   switch (dyn.type()) {
@@ -49,6 +266,11 @@ Value valueFromDynamicShallow(
     case folly::dynamic::INT64:
       return Value((double)dyn.getInt());
     case folly::dynamic::OBJECT: {
+      if (cache) {
+        if (auto leaf = leafObjectFromDynamic(runtime, *cache, dyn)) {
+          return Value(std::move(*leaf));
+        }
+      }
       auto obj = Object(runtime);
       Value ret = Value(runtime, obj);
       stack.emplace_back(&dyn, std::move(obj));
@@ -64,8 +286,9 @@ Value valueFromDynamicShallow(
 
 Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
   std::vector<FromDynamic> stack;
+  auto cache = getConversionCache(runtime);
 
-  Value ret = valueFromDynamicShallow(runtime, stack, dynInput);
+  Value ret = valueFromDynamicShallow(runtime, cache, stack, dynInput);
 
   while (!stack.empty()) {
     auto top = std::move(stack.back());
@@ -78,18 +301,30 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
           arr.setValueAtIndex(
               runtime,
               i,
-              valueFromDynamicShallow(runtime, stack, (*top.dyn)[i]));
+              valueFromDynamicShallow(runtime, cache, stack, (*top.dyn)[i]));
         }
         break;
       }
       case folly::dynamic::OBJECT: {
         Object obj = std::move(top.obj);
+        auto propNameIDs =
+            cache ? cache->getPropNameIDs(runtime, *top.dyn) : nullptr;
+        if (propNameIDs) {
+          size_t i = 0;
+          for (const auto& element : top.dyn->items()) {
+            obj.setProperty(
+                runtime,
+                (*propNameIDs)[i++],
+                valueFromDynamicShallow(runtime, cache, stack, element.second));
+          }
+          break;
+        }
         for (const auto& element : top.dyn->items()) {
           if (element.first.isNumber() || element.first.isString()) {
             obj.setProperty(
                 runtime,
                 PropNameID::forUtf8(runtime, element.first.asString()),
-                valueFromDynamicShallow(runtime, stack, element.second));
+                valueFromDynamicShallow(runtime, cache, stack, element.second));
           }
         }
         break;
@@ -147,6 +382,7 @@ void dynamicFromValueShallow(
 
 folly::dynamic dynamicFromValue(Runtime& runtime, const Value& valueInput) {
   std::vector<FromValue> stack;
+  auto cache = getConversionCache(runtime);
   folly::dynamic ret;
 
   dynamicFromValueShallow(runtime, stack, valueInput, ret);
@@ -170,10 +406,34 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& valueInput) {
       }
     } else {
       Array names = top.obj.getPropertyNames(runtime);
+      size_t namesSize = names.size(runtime);
       std::vector<std::pair<std::string, jsi::Value>> props;
-      for (size_t i = 0; i < names.size(runtime); ++i) {
-        String name = names.getValueAtIndex(runtime, i).getString(runtime);
-        Value prop = top.obj.getProperty(runtime, name);
+
+      // Objects with the same keys as a recently converted one are read
+      // through cached PropNameIDs and keys, instead of converting every
+      // name to UTF-8 again.
+      const std::pair<std::vector<std::string>, std::vector<PropNameID>>*
+          keys = nullptr;
+      std::vector<String> nameStrings;
+      nameStrings.reserve(namesSize);
+      for (size_t i = 0; i < namesSize; ++i) {
+        nameStrings.push_back(
+            names.getValueAtIndex(runtime, i).getString(runtime));
+      }
+      if (cache && namesSize > 0) {
+        keys = &cache->getKeys(runtime, std::move(nameStrings));
+      }
+
+      std::vector<Value> values;
+      if (keys) {
+        values.resize(namesSize);
+        top.obj.getProperties(
+            runtime, keys->second.data(), values.data(), namesSize);
+      }
+
+      for (size_t i = 0; i < namesSize; ++i) {
+        Value prop = keys ? std::move(values[i])
+                          : top.obj.getProperty(runtime, nameStrings[i]);
         if (prop.isUndefined()) {
           continue;
         }
@@ -183,7 +443,9 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& valueInput) {
         if (prop.isObject() && prop.getObject(runtime).isFunction(runtime)) {
           prop = Value::null();
         }
-        props.emplace_back(name.utf8(runtime), std::move(prop));
+        props.emplace_back(
+            keys ? keys->first[i] : nameStrings[i].utf8(runtime),
+            std::move(prop));
         top.dyn->insert(props.back().first, nullptr);
       }
       for (const auto& prop : props) {
@@ -196,5 +458,30 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& valueInput) {
   return ret;
 }
 
+void enableDynamicConversionCache(Runtime& runtime, size_t capacity) {
+  std::lock_guard<std::mutex> lock(getConversionCachesMutex());
+  auto& cache = getConversionCaches()[&runtime];
+  if (!cache) {
+    numberOfConversionCaches++;
+  }
+  cache = std::make_unique<ConversionCache>(capacity);
+}
+
+void disableDynamicConversionCache(Runtime& runtime) {
+  auto cache = std::unique_ptr<ConversionCache>{};
+  {
+    std::lock_guard<std::mutex> lock(getConversionCachesMutex());
+    auto& caches = getConversionCaches();
+    auto it = caches.find(&runtime);
+    if (it == caches.end()) {
+      return;
+    }
+    cache = std::move(it->second);
+    caches.erase(it);
+    numberOfConversionCaches--;
+  }
+  // The cached JS values are released here, outside of the lock.
+}
+
 } // namespace jsi
 } // namespace facebook
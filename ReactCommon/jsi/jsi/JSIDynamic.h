@@ -21,5 +21,17 @@ folly::dynamic dynamicFromValue(
     facebook::jsi::Runtime& runtime,
     const facebook::jsi::Value& value);
 
+/// Makes valueFromDynamic and dynamicFromValue reuse the PropNameIDs of the
+/// object keys they convert for \p runtime: up to \p capacity of them are
+/// kept (least recently used first out), along with the key sets (shapes) of
+/// recently converted objects.
+/// The cache holds JS values, so it must be disabled (on the runtime's
+/// thread) before \p runtime is destroyed.
+void enableDynamicConversionCache(
+    facebook::jsi::Runtime& runtime,
+    size_t capacity = 1024);
+
+void disableDynamicConversionCache(facebook::jsi::Runtime& runtime);
+
 } // namespace jsi
 } // namespace facebook
@@ -185,6 +185,12 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
   std::string utf8(const PropNameID& id) override {
     return plain_.utf8(id);
   };
+  void getPropNameIdData(
+      const PropNameID& sym,
+      void* ctx,
+      void (*cb)(void* ctx, const char* utf8, size_t length)) override {
+    plain_.getPropNameIdData(sym, ctx, cb);
+  };
   bool compare(const PropNameID& a, const PropNameID& b) override {
     return plain_.compare(a, b);
   };
@@ -221,6 +227,12 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
   std::string utf8(const String& s) override {
     return plain_.utf8(s);
   }
+  void getStringData(
+      const String& str,
+      void* ctx,
+      void (*cb)(void* ctx, const char* utf8, size_t length)) override {
+    plain_.getStringData(str, ctx, cb);
+  }
 
   Object createObject() override {
     return plain_.createObject();
@@ -230,6 +242,12 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
     return plain_.createObject(
         std::make_shared<DecoratedHostObject>(*this, std::move(ho)));
   };
+  Object createObjectWithProperties(
+      const PropNameID* names,
+      const Value* values,
+      size_t count) override {
+    return plain_.createObjectWithProperties(names, values, count);
+  };
   std::shared_ptr<HostObject> getHostObject(const jsi::Object& o) override {
     std::shared_ptr<HostObject> dho = plain_.getHostObject(o);
     return static_cast<DecoratedHostObject&>(*dho).plainHO_;
@@ -258,6 +276,13 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
   Value getProperty(const Object& o, const String& name) override {
     return plain_.getProperty(o, name);
   };
+  void getProperties(
+      const Object& o,
+      const PropNameID* names,
+      Value* values,
+      size_t count) override {
+    plain_.getProperties(o, names, values, count);
+  };
   bool hasProperty(const Object& o, const PropNameID& name) override {
     return plain_.hasProperty(o, name);
   };
@@ -600,6 +625,13 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     return RD::utf8(id);
   };
+  void getPropNameIdData(
+      const PropNameID& sym,
+      void* ctx,
+      void (*cb)(void* ctx, const char* utf8, size_t length)) override {
+    Around around{with_};
+    RD::getPropNameIdData(sym, ctx, cb);
+  };
   bool compare(const PropNameID& a, const PropNameID& b) override {
     Around around{with_};
     return RD::compare(a, b);
@@ -622,6 +654,13 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     return RD::utf8(s);
   }
+  void getStringData(
+      const String& str,
+      void* ctx,
+      void (*cb)(void* ctx, const char* utf8, size_t length)) override {
+    Around around{with_};
+    RD::getStringData(str, ctx, cb);
+  }
 
   Object createObject() override {
     Around around{with_};
@@ -631,6 +670,13 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     return RD::createObject(std::move(ho));
   };
+  Object createObjectWithProperties(
+      const PropNameID* names,
+      const Value* values,
+      size_t count) override {
+    Around around{with_};
+    return RD::createObjectWithProperties(names, values, count);
+  };
   std::shared_ptr<HostObject> getHostObject(const jsi::Object& o) override {
     Around around{with_};
     return RD::getHostObject(o);
@@ -648,6 +694,14 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     return RD::getProperty(o, name);
   };
+  void getProperties(
+      const Object& o,
+      const PropNameID* names,
+      Value* values,
+      size_t count) override {
+    Around around{with_};
+    RD::getProperties(o, names, values, count);
+  };
   bool hasProperty(const Object& o, const PropNameID& name) override {
     Around around{with_};
     return RD::hasProperty(o, name);
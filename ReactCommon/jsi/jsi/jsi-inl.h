@@ -56,6 +56,13 @@ inline PropNameID&& toPropNameID(Runtime&, PropNameID&& name) {
   return std::move(name);
 }
 
+/// Adapts a callable to the callbacks of Runtime::getStringData and
+/// Runtime::getPropNameIdData.
+template <typename F>
+void invokeUtf8Callback(void* ctx, const char* utf8, size_t length) {
+  (*static_cast<F*>(ctx))(utf8, length);
+}
+
 /// Helper to throw while still compiling with exceptions turned off.
 template <typename E, typename... Args>
 [[noreturn]] inline void throwOrDie(Args&&... args) {
@@ -321,6 +328,24 @@ inline std::vector<PropNameID> PropNameID::names(
   return result;
 }
 
+template <typename F>
+inline void PropNameID::withUtf8(Runtime& runtime, F&& f) const {
+  using Callback = typename std::remove_reference<F>::type;
+  runtime.getPropNameIdData(
+      *this,
+      const_cast<void*>(static_cast<const void*>(&f)),
+      detail::invokeUtf8Callback<Callback>);
+}
+
+template <typename F>
+inline void String::withUtf8(Runtime& runtime, F&& f) const {
+  using Callback = typename std::remove_reference<F>::type;
+  runtime.getStringData(
+      *this,
+      const_cast<void*>(static_cast<const void*>(&f)),
+      detail::invokeUtf8Callback<Callback>);
+}
+
 inline Value Function::callAsConstructor(
     Runtime& runtime,
     const Value* args,
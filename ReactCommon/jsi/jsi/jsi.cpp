@@ -143,6 +143,43 @@ Value Runtime::createValueFromJsonUtf8(const uint8_t* json, size_t length) {
   return parseJson.call(*this, String::createFromUtf8(*this, json, length));
 }
 
+void Runtime::getPropNameIdData(
+    const PropNameID& sym,
+    void* ctx,
+    void (*cb)(void* ctx, const char* utf8, size_t length)) {
+  auto data = utf8(sym);
+  cb(ctx, data.data(), data.size());
+}
+
+void Runtime::getStringData(
+    const String& str,
+    void* ctx,
+    void (*cb)(void* ctx, const char* utf8, size_t length)) {
+  auto data = utf8(str);
+  cb(ctx, data.data(), data.size());
+}
+
+Object Runtime::createObjectWithProperties(
+    const PropNameID* names,
+    const Value* values,
+    size_t count) {
+  Object object = createObject();
+  for (size_t i = 0; i < count; ++i) {
+    setPropertyValue(object, names[i], values[i]);
+  }
+  return object;
+}
+
+void Runtime::getProperties(
+    const Object& object,
+    const PropNameID* names,
+    Value* values,
+    size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    values[i] = getProperty(object, names[i]);
+  }
+}
+
 Pointer& Pointer::operator=(Pointer&& other) {
   if (ptr_) {
     ptr_->invalidate();
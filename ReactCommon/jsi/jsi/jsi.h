@@ -302,6 +302,14 @@ class JSI_EXPORT Runtime {
   virtual PropNameID createPropNameIDFromString(const String& str) = 0;
   virtual PropNameID createPropNameIDFromSymbol(const Symbol& sym) = 0;
   virtual std::string utf8(const PropNameID&) = 0;
+  // Calls \c cb with \c ctx and the contents of the name encoded as UTF-8
+  // (not null-terminated), which are only valid during the call. Runtimes
+  // which store the name as ASCII or UTF-8 can pass their own buffer. The
+  // default implementation passes a copy made by utf8().
+  virtual void getPropNameIdData(
+      const PropNameID& sym,
+      void* ctx,
+      void (*cb)(void* ctx, const char* utf8, size_t length));
   virtual bool compare(const PropNameID&, const PropNameID&) = 0;
 
   virtual std::string symbolToString(const Symbol&) = 0;
@@ -316,6 +324,11 @@ class JSI_EXPORT Runtime {
   virtual String createStringFromAscii(const char* str, size_t length) = 0;
   virtual String createStringFromUtf8(const uint8_t* utf8, size_t length) = 0;
   virtual std::string utf8(const String&) = 0;
+  // Like getPropNameIdData, for a string.
+  virtual void getStringData(
+      const String& str,
+      void* ctx,
+      void (*cb)(void* ctx, const char* utf8, size_t length));
 
   // \return a \c Value created from a utf8-encoded JSON string. The default
   // implementation creates a \c String and invokes JSON.parse.
@@ -323,6 +336,14 @@ class JSI_EXPORT Runtime {
 
   virtual Object createObject() = 0;
   virtual Object createObject(std::shared_ptr<HostObject> ho) = 0;
+
+  // \return an object with the properties \c names[i] set to \c values[i]
+  // (for i < count). The default implementation creates an empty object
+  // and sets the properties one by one.
+  virtual Object createObjectWithProperties(
+      const PropNameID* names,
+      const Value* values,
+      size_t count);
   virtual std::shared_ptr<HostObject> getHostObject(const jsi::Object&) = 0;
   virtual HostFunctionType& getHostFunction(const jsi::Function&) = 0;
 
@@ -334,6 +355,14 @@ class JSI_EXPORT Runtime {
 
   virtual Value getProperty(const Object&, const PropNameID& name) = 0;
   virtual Value getProperty(const Object&, const String& name) = 0;
+  // Reads the properties \c names[i] of the object into \c values[i] (for
+  // i < count). The default implementation calls getProperty for each of
+  // them.
+  virtual void getProperties(
+      const Object&,
+      const PropNameID* names,
+      Value* values,
+      size_t count);
   virtual bool hasProperty(const Object&, const PropNameID& name) = 0;
   virtual bool hasProperty(const Object&, const String& name) = 0;
   virtual void
@@ -486,6 +515,13 @@ class JSI_EXPORT PropNameID : public Pointer {
     return runtime.utf8(*this);
   }
 
+  /// Calls \p f with a pointer to the data in a PropNameID as utf8 and its
+  /// length in bytes. The data isn't null-terminated, and is only valid
+  /// during the call. Unlike utf8(), this doesn't copy the data on runtimes
+  /// which can expose their own buffer.
+  template <typename F>
+  void withUtf8(Runtime& runtime, F&& f) const;
+
   static bool compare(
       Runtime& runtime,
       const jsi::PropNameID& a,
@@ -636,6 +672,13 @@ class JSI_EXPORT String : public Pointer {
     return runtime.utf8(*this);
   }
 
+  /// Calls \p f with a pointer to the data in a JS string as utf8 and its
+  /// length in bytes. The data isn't null-terminated, and is only valid
+  /// during the call. Unlike utf8(), this doesn't copy the data on runtimes
+  /// which can expose their own buffer.
+  template <typename F>
+  void withUtf8(Runtime& runtime, F&& f) const;
+
   friend class Runtime;
   friend class Value;
 };
@@ -660,6 +703,17 @@ class JSI_EXPORT Object : public Pointer {
     return runtime.createObject(ho);
   }
 
+  /// Creates a new Object instance with the properties \c names[i] set to
+  /// \c values[i] (for i < count). Cheaper than creating an empty object and
+  /// setting the properties one at a time on runtimes which support it.
+  static Object createWithProperties(
+      Runtime& runtime,
+      const PropNameID* names,
+      const Value* values,
+      size_t count) {
+    return runtime.createObjectWithProperties(names, values, count);
+  }
+
   /// \return whether this and \c obj are the same JSObject or not.
   static bool strictEquals(Runtime& runtime, const Object& a, const Object& b) {
     return runtime.strictEquals(a, b);
@@ -685,6 +739,18 @@ class JSI_EXPORT Object : public Pointer {
   /// undefined value.
   Value getProperty(Runtime& runtime, const PropNameID& name) const;
 
+  /// Reads the properties \c names[i] of the object into \c values[i] (for
+  /// i < count), in a single call into the runtime on runtimes which support
+  /// it. If the name isn't a property on the object, the value is undefined.
+  /// If reading a property throws, the remaining values are left untouched.
+  void getProperties(
+      Runtime& runtime,
+      const PropNameID* names,
+      Value* values,
+      size_t count) const {
+    runtime.getProperties(*this, names, values, count);
+  }
+
   /// \return true if and only if the object has a property with the
   /// given ascii name.
   bool hasProperty(Runtime& runtime, const char* name) const;
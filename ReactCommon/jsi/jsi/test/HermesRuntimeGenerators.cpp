@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/testlib.h>
+
+#include <hermes/hermes.h>
+
+namespace facebook {
+namespace jsi {
+
+// Runs the tests and benchmarks of this directory against Hermes.
+std::vector<RuntimeFactory> runtimeGenerators() {
+  return {[] { return facebook::hermes::makeHermesRuntime(); }};
+}
+
+} // namespace jsi
+} // namespace facebook
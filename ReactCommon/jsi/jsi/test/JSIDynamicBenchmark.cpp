@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/testlib.h>
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+
+using namespace facebook::jsi;
+
+namespace {
+
+// Like testlib, the benchmarks run against the runtimes of the engine they are
+// linked with (see `runtimeGenerators()`).
+std::unique_ptr<Runtime> makeRuntime() {
+  return runtimeGenerators().front()();
+}
+
+// A touch event, as dispatched by the renderer.
+folly::dynamic makeEventPayload(int index) {
+  auto touch = folly::dynamic::object("identifier", index)(
+      "locationX", 10.5)("locationY", 20.5)("pageX", 110.5)("pageY", 220.5)(
+      "target", 42)("timestamp", 1000.0 + index)("force", 0.5);
+  return folly::dynamic::object("changedTouches", folly::dynamic::array(touch))(
+      "touches", folly::dynamic::array(touch))("identifier", index)(
+      "locationX", 10.5)("locationY", 20.5)("pageX", 110.5)("pageY", 220.5)(
+      "target", 42)("timestamp", 1000.0 + index);
+}
+
+// Props of a view, as sent by the legacy UIManager.
+folly::dynamic makePropsPayload(int index) {
+  return folly::dynamic::object("backgroundColor", 0xff00ff00)(
+      "borderRadius", 4)("opacity", 1)("testID", "view")(
+      "accessibilityLabel", "label")("nativeID", index)(
+      "style",
+      folly::dynamic::object("flex", 1)("flexDirection", "row")(
+          "alignItems", "center")("justifyContent", "space-between")(
+          "paddingHorizontal", 16)("paddingVertical", 8)("marginTop", index));
+}
+
+template <folly::dynamic (*makePayload)(int)>
+void valueFromDynamicBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto& rt = *runtime;
+  if (state.range(0) != 0) {
+    enableDynamicConversionCache(rt);
+  }
+
+  auto payloads = std::vector<folly::dynamic>{};
+  for (int i = 0; i < 100; i++) {
+    payloads.push_back(makePayload(i));
+  }
+
+  for (auto _ : state) {
+    for (const auto& payload : payloads) {
+      benchmark::DoNotOptimize(valueFromDynamic(rt, payload));
+    }
+  }
+
+  disableDynamicConversionCache(rt);
+  state.SetItemsProcessed(state.iterations() * payloads.size());
+}
+
+template <folly::dynamic (*makePayload)(int)>
+void dynamicFromValueBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto& rt = *runtime;
+
+  auto values = std::vector<Value>{};
+  for (int i = 0; i < 100; i++) {
+    values.push_back(valueFromDynamic(rt, makePayload(i)));
+  }
+
+  if (state.range(0) != 0) {
+    enableDynamicConversionCache(rt);
+  }
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(dynamicFromValue(rt, value));
+    }
+  }
+
+  disableDynamicConversionCache(rt);
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// The argument is whether the conversion cache is enabled.
+BENCHMARK_TEMPLATE(valueFromDynamicBenchmark, makeEventPayload)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(valueFromDynamicBenchmark, makePropsPayload)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(dynamicFromValueBenchmark, makeEventPayload)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(dynamicFromValueBenchmark, makePropsPayload)->Arg(0)->Arg(1);
+
+} // namespace
+
+BENCHMARK_MAIN();
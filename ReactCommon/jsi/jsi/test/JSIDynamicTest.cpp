@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/testlib.h>
+
+#include <folly/dynamic.h>
+#include <gtest/gtest.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+
+#include <string>
+#include <vector>
+
+using namespace facebook::jsi;
+
+class JSIDynamicTest : public JSITestBase {
+ public:
+  ~JSIDynamicTest() override {
+    disableDynamicConversionCache(rt);
+  }
+
+  // Whether `a` and `b` have the same properties, in the same order.
+  bool haveSameJson(const Value& a, const Value& b) {
+    return function(
+               "function(a, b) {"
+               "  return JSON.stringify(a) === JSON.stringify(b);"
+               "}")
+        .call(rt, a, b)
+        .getBool();
+  }
+};
+
+namespace {
+
+folly::dynamic makeTouch(int index) {
+  return folly::dynamic::object("identifier", index)("locationX", 10.5)(
+      "locationY", 20.5)("target", 42)("timestamp", 1000.0 + index);
+}
+
+// Payloads sharing shapes with each other (and with themselves), so that
+// converting them with the cache enabled hits it.
+std::vector<folly::dynamic> makePayloads() {
+  auto payloads = std::vector<folly::dynamic>{};
+  for (int i = 0; i < 3; i++) {
+    payloads.push_back(folly::dynamic::object(
+        "changedTouches", folly::dynamic::array(makeTouch(i)))(
+        "touches", folly::dynamic::array(makeTouch(i), makeTouch(i + 1)))(
+        "identifier", i)("target", 42));
+  }
+  payloads.push_back(folly::dynamic::array(
+      makeTouch(1), folly::dynamic::object(), folly::dynamic::array()));
+  // The same keys as a touch, in a different order.
+  payloads.push_back(folly::dynamic::object("timestamp", 1.0)("target", 2)(
+      "locationY", 3)("locationX", 4)("identifier", 5));
+  // Non-string keys, which are not cached.
+  payloads.push_back(
+      folly::dynamic::object(1, "one")("two", 2)(3.5, folly::dynamic::array()));
+  payloads.push_back(folly::dynamic::object("nested", makeTouch(7))(
+      "string", "é中")("null", nullptr)("bool", true));
+  payloads.push_back("not an object");
+  return payloads;
+}
+
+} // namespace
+
+TEST_P(JSIDynamicTest, ValueFromDynamicWithCache) {
+  auto payloads = makePayloads();
+  auto expected = std::vector<Value>{};
+  for (const auto& payload : payloads) {
+    expected.push_back(valueFromDynamic(rt, payload));
+  }
+
+  enableDynamicConversionCache(rt);
+  // The second pass converts the payloads through the shapes cached by the
+  // first one.
+  for (int pass = 0; pass < 2; pass++) {
+    for (size_t i = 0; i < payloads.size(); i++) {
+      auto value = valueFromDynamic(rt, payloads[i]);
+      EXPECT_TRUE(haveSameJson(expected[i], value)) << "payload " << i;
+      EXPECT_EQ(dynamicFromValue(rt, expected[i]), dynamicFromValue(rt, value))
+          << "payload " << i;
+    }
+  }
+}
+
+TEST_P(JSIDynamicTest, ValueFromDynamicWithShapesEvictedDuringConversion) {
+  // The shape of the outer object is evicted while its values, which all have
+  // a different shape (and are converted as soon as they are reached, as they
+  // only contain primitives), are converted.
+  folly::dynamic payload = folly::dynamic::object();
+  for (int i = 0; i < 100; i++) {
+    auto index = std::to_string(i);
+    payload["outer" + index] =
+        folly::dynamic::object("inner" + index, i)("leaf" + index, index);
+  }
+  auto expected = valueFromDynamic(rt, payload);
+
+  enableDynamicConversionCache(rt);
+  for (int pass = 0; pass < 2; pass++) {
+    auto value = valueFromDynamic(rt, payload);
+    EXPECT_TRUE(haveSameJson(expected, value));
+    EXPECT_EQ(dynamicFromValue(rt, expected), dynamicFromValue(rt, value));
+  }
+}
+
+TEST_P(JSIDynamicTest, DynamicFromValueWithCache) {
+  auto values = std::vector<Value>{};
+  for (auto code :
+       {"({a: 1, b: 'b', c: [1, 2, {a: 2, b: 'c', c: null}]})",
+        "({b: 1, a: 2, c: 3})",
+        "({a: undefined, b: function() {}, c: true})",
+        "({1: 'one', 0: 'zero', x: {}})",
+        "[{a: 1, b: 2, c: 3}, {a: 4, b: 5, c: 6}, {}, []]",
+        "Object.create({inherited: 1}, {own: {value: 2, enumerable: true}})",
+        "({'é': 1, '中': {'é': 2}})",
+        "'string'"}) {
+    values.push_back(eval(code));
+  }
+  // More shapes than the cache keeps.
+  for (int i = 0; i < 40; i++) {
+    values.push_back(eval(
+        ("({['key' + " + std::to_string(i) + "]: 1, shared: {a: 1}})")
+            .c_str()));
+  }
+
+  auto expected = std::vector<folly::dynamic>{};
+  for (const auto& value : values) {
+    expected.push_back(dynamicFromValue(rt, value));
+  }
+
+  enableDynamicConversionCache(rt);
+  for (int pass = 0; pass < 2; pass++) {
+    for (size_t i = 0; i < values.size(); i++) {
+      EXPECT_EQ(expected[i], dynamicFromValue(rt, values[i])) << "value " << i;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Runtimes,
+    JSIDynamicTest,
+    ::testing::ValuesIn(runtimeGenerators()));
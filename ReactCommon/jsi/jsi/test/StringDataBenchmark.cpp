@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/testlib.h>
+
+#include <benchmark/benchmark.h>
+#include <jsi/jsi.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace facebook::jsi;
+
+namespace {
+
+// Heap allocations made by this process, to report them per iteration.
+std::atomic<size_t> numberOfAllocations{0};
+
+} // namespace
+
+void* operator new(size_t size) {
+  numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size > 0 ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace {
+
+std::unique_ptr<Runtime> makeRuntime() {
+  return runtimeGenerators().front()();
+}
+
+// What `nativeFabricUIManager.createNode` reads from its arguments before the
+// props are parsed: the name of the view and the names of its props (see
+// `stringFromValue` and `RawPropsParser::preparse`).
+constexpr const char* kProps = R"JS(({
+  accessibilityLabel: 'Close',
+  accessibilityRole: 'button',
+  backgroundColor: 0xff00ff00,
+  borderBottomLeftRadius: 4,
+  borderBottomRightRadius: 4,
+  collapsable: false,
+  flexDirection: 'row',
+  justifyContent: 'space-between',
+  nativeID: 'close-button',
+  onStartShouldSetResponder: true,
+  paddingHorizontal: 16,
+  pointerEvents: 'box-none',
+  testID: 'close',
+}))JS";
+
+struct CreateNodeArguments {
+  explicit CreateNodeArguments(Runtime& rt)
+      : viewName(String::createFromAscii(rt, "RCTView")) {
+    auto props =
+        rt.evaluateJavaScript(std::make_shared<StringBuffer>(kProps), "")
+            .getObject(rt);
+    auto names = props.getPropertyNames(rt);
+    for (size_t i = 0; i < names.size(rt); i++) {
+      propNames.push_back(names.getValueAtIndex(rt, i).getString(rt));
+    }
+  }
+
+  String viewName;
+  std::vector<String> propNames;
+};
+
+// Stands in for the lookup of a prop name in `RawPropsKeyMap`.
+size_t lookUp(const char* name, size_t length) {
+  return length > 0 ? static_cast<size_t>(name[0]) + length : 0;
+}
+
+void reportAllocations(benchmark::State& state, size_t allocationsBefore) {
+  auto allocations =
+      numberOfAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocations),
+      benchmark::Counter::kAvgIterations);
+}
+
+void createNodeStringsWithCopies(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto& rt = *runtime;
+  auto arguments = CreateNodeArguments(rt);
+
+  auto allocationsBefore = numberOfAllocations.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    auto viewName = arguments.viewName.utf8(rt);
+    benchmark::DoNotOptimize(viewName);
+    for (const auto& propName : arguments.propNames) {
+      auto name = propName.utf8(rt);
+      benchmark::DoNotOptimize(lookUp(name.data(), name.size()));
+    }
+  }
+  reportAllocations(state, allocationsBefore);
+}
+BENCHMARK(createNodeStringsWithCopies);
+
+void createNodeStringsWithViews(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto& rt = *runtime;
+  auto arguments = CreateNodeArguments(rt);
+
+  auto allocationsBefore = numberOfAllocations.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    // The view name is stored, so it's copied either way.
+    auto viewName = arguments.viewName.utf8(rt);
+    benchmark::DoNotOptimize(viewName);
+    for (const auto& propName : arguments.propNames) {
+      propName.withUtf8(rt, [&](const char* utf8, size_t length) {
+        benchmark::DoNotOptimize(lookUp(utf8, length));
+      });
+    }
+  }
+  reportAllocations(state, allocationsBefore);
+}
+BENCHMARK(createNodeStringsWithViews);
+
+} // namespace
+
+BENCHMARK_MAIN();
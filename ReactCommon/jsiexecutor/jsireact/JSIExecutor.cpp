@@ -18,6 +18,7 @@
 #include <jsi/JSIDynamic.h>
 #include <jsi/instrumentation.h>
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
+#include <reactperflogger/TraceBuffer.h>
 
 #include <sstream>
 #include <stdexcept>
@@ -80,8 +81,14 @@ JSIExecutor::JSIExecutor(
       *runtime, "__jsiExecutorDescription", runtime->description());
 }
 
+JSIExecutor::~JSIExecutor() {
+  disableDynamicConversionCache(*runtime_);
+}
+
 void JSIExecutor::initializeRuntime() {
   SystraceSection s("JSIExecutor::initializeRuntime");
+  // Bridge payloads (module results, events) repeat the same keys.
+  enableDynamicConversionCache(*runtime_);
   runtime_->global().setProperty(
       *runtime_,
       "nativeModuleProxy",
@@ -108,6 +115,11 @@ void JSIExecutor::initializeRuntime() {
             return Value::undefined();
           }));
 
+  // Lets MessageQueue flush calls in the binary format, which is parsed
+  // without converting the whole queue to `folly::dynamic`.
+  runtime_->global().setProperty(
+      *runtime_, "nativeSupportsBinaryMethodCallBatches", true);
+
   runtime_->global().setProperty(
       *runtime_,
       "nativeCallSyncHook",
@@ -134,13 +146,12 @@ void JSIExecutor::initializeRuntime() {
               const jsi::Value *args,
               size_t count) { return globalEvalWithSourceUrl(args, count); }));
 
+  bindNativeTraceBuffer(*runtime_);
+
   if (runtimeInstaller_) {
     runtimeInstaller_(*runtime_);
   }
-  bool hasLogger(ReactMarker::logTaggedMarker);
-  if (hasLogger) {
-    ReactMarker::logMarker(ReactMarker::CREATE_REACT_CONTEXT_STOP);
-  }
+  ReactMarker::logMarker(ReactMarker::CREATE_REACT_CONTEXT_STOP, nullptr);
 }
 
 void JSIExecutor::loadBundle(
@@ -148,19 +159,11 @@ void JSIExecutor::loadBundle(
     std::string sourceURL) {
   SystraceSection s("JSIExecutor::loadBundle");
 
-  bool hasLogger(ReactMarker::logTaggedMarker);
   std::string scriptName = simpleBasename(sourceURL);
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
-  }
-  runtime_->evaluateJavaScript(
-      std::make_unique<BigStringBuffer>(std::move(script)), sourceURL);
+  ReactMarker::logMarker(ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
+  evaluateBundle(std::move(script), sourceURL);
   flush();
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
 }
 
 void JSIExecutor::setBundleRegistry(std::unique_ptr<RAMBundleRegistry> r) {
@@ -185,8 +188,7 @@ void JSIExecutor::registerBundle(
     uint32_t bundleId,
     const std::string &bundlePath) {
   const auto tag = folly::to<std::string>(bundleId);
-  ReactMarker::logTaggedMarker(
-      ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
+  ReactMarker::logMarker(ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
   if (bundleRegistry_) {
     bundleRegistry_->registerBundle(bundleId, bundlePath);
   } else {
@@ -195,12 +197,29 @@ void JSIExecutor::registerBundle(
       throw std::invalid_argument(
           "Empty bundle registered with ID " + tag + " from " + bundlePath);
     }
-    runtime_->evaluateJavaScript(
-        std::make_unique<BigStringBuffer>(std::move(script)),
+    evaluateBundle(
+        std::move(script),
         JSExecutor::getSyntheticBundlePath(bundleId, bundlePath));
   }
-  ReactMarker::logTaggedMarker(
-      ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
+  ReactMarker::logMarker(ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
+}
+
+void JSIExecutor::setPreparedJavaScriptCache(
+    std::shared_ptr<PreparedJavaScriptCache> cache) {
+  preparedJavaScriptCache_ = std::move(cache);
+}
+
+void JSIExecutor::evaluateBundle(
+    std::unique_ptr<const JSBigString> script,
+    const std::string &sourceURL) {
+  auto buffer = std::make_shared<BigStringBuffer>(std::move(script));
+  if (!preparedJavaScriptCache_) {
+    runtime_->evaluateJavaScript(buffer, sourceURL);
+    return;
+  }
+  auto preparedJavaScript =
+      preparedJavaScriptCache_->prepareJavaScript(*runtime_, buffer, sourceURL);
+  runtime_->evaluatePreparedJavaScript(preparedJavaScript);
 }
 
 // Looping on \c drainMicrotasks until it completes or hits the retries bound.
@@ -254,7 +273,7 @@ void JSIExecutor::callFunction(
               *runtime_,
               moduleId,
               methodId,
-              valueFromDynamic(*runtime_, arguments));
+              valueFromBridgePayload(*runtime_, arguments));
         },
         std::move(errorProducer));
   } catch (...) {
@@ -277,7 +296,7 @@ void JSIExecutor::invokeCallback(
   Value ret;
   try {
     ret = invokeCallbackAndReturnFlushedQueue_->call(
-        *runtime_, callbackId, valueFromDynamic(*runtime_, arguments));
+        *runtime_, callbackId, valueFromBridgePayload(*runtime_, arguments));
   } catch (...) {
     std::throw_with_nested(std::runtime_error(
         folly::to<std::string>("Error invoking callback ", callbackId)));
@@ -413,10 +432,72 @@ void JSIExecutor::callNativeModules(const Value &queue, bool isEndOfBatch) {
 #endif
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
+  if (queue.isObject()) {
+    auto queueObject = queue.getObject(*runtime_);
+    if (queueObject.isArray(*runtime_)) {
+      auto queueArray = std::move(queueObject).getArray(*runtime_);
+      auto batch = queueArray.getValueAtIndex(*runtime_, 0);
+      if (batch.isObject() &&
+          batch.getObject(*runtime_).isArrayBuffer(*runtime_)) {
+        delegate_->callNativeModules(
+            *this, parseBinaryMethodCalls(queueArray), isEndOfBatch);
+        return;
+      }
+    }
+  }
+
   delegate_->callNativeModules(
       *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
 }
 
+std::vector<MethodCall> JSIExecutor::parseBinaryMethodCalls(
+    const jsi::Array &queue) {
+  // [ArrayBuffer, strings, complexArguments], see `encodeBinaryQueue` in
+  // MessageQueue.js.
+  if (queue.size(*runtime_) != 3) {
+    throw std::invalid_argument("Malformed binary batch of calls from JS");
+  }
+
+  auto buffer = queue.getValueAtIndex(*runtime_, 0)
+                    .getObject(*runtime_)
+                    .getArrayBuffer(*runtime_);
+
+  auto strings = queue.getValueAtIndex(*runtime_, 1)
+                     .asObject(*runtime_)
+                     .asArray(*runtime_);
+  auto stringsSize = strings.size(*runtime_);
+  std::vector<std::string> batchStrings;
+  batchStrings.reserve(stringsSize);
+  for (size_t i = 0; i < stringsSize; i++) {
+    batchStrings.push_back(
+        strings.getValueAtIndex(*runtime_, i).asString(*runtime_).utf8(
+            *runtime_));
+  }
+
+  // Objects and arrays go through the regular conversion.
+  auto complexArguments = queue.getValueAtIndex(*runtime_, 2)
+                              .asObject(*runtime_)
+                              .asArray(*runtime_);
+  auto complexArgumentsSize = complexArguments.size(*runtime_);
+  std::vector<folly::dynamic> batchComplexArguments;
+  batchComplexArguments.reserve(complexArgumentsSize);
+  for (size_t i = 0; i < complexArgumentsSize; i++) {
+    batchComplexArguments.push_back(dynamicFromValue(
+        *runtime_, complexArguments.getValueAtIndex(*runtime_, i)));
+  }
+
+  auto data = buffer.data(*runtime_);
+  if (reinterpret_cast<uintptr_t>(data) % alignof(double) != 0) {
+    throw std::invalid_argument("Misaligned binary batch of calls from JS");
+  }
+
+  return parseMethodCalls(BinaryMethodCallBatch{
+      reinterpret_cast<const double *>(data),
+      buffer.size(*runtime_) / sizeof(double),
+      std::move(batchStrings),
+      std::move(batchComplexArguments)});
+}
+
 void JSIExecutor::flush() {
   SystraceSection s("JSIExecutor::flush");
   if (flushedQueue_) {
@@ -459,8 +540,14 @@ Value JSIExecutor::nativeRequire(const Value *args, size_t count) {
   uint32_t bundleId = count == 2 ? folly::to<uint32_t>(args[1].getNumber()) : 0;
   auto module = bundleRegistry_->getModule(bundleId, moduleId);
 
-  runtime_->evaluateJavaScript(
-      std::make_unique<StringBuffer>(module.code), module.name);
+  if (module.source) {
+    runtime_->evaluateJavaScript(
+        std::make_unique<BigStringBuffer>(std::move(module.source)),
+        module.name);
+  } else {
+    runtime_->evaluateJavaScript(
+        std::make_unique<StringBuffer>(std::move(module.code)), module.name);
+  }
   return facebook::jsi::Value();
 }
 
@@ -512,7 +599,7 @@ Value JSIExecutor::nativeCallSyncHook(const Value *args, size_t count) {
     return Value::undefined();
   }
 
-  Value returnValue = valueFromDynamic(*runtime_, result.value());
+  Value returnValue = valueFromBridgePayload(*runtime_, result.value());
 
   if (moduleRegistry_) {
     BridgeNativeModulePerfLogger::syncMethodCallReturnConversionEnd(
@@ -540,6 +627,64 @@ Value JSIExecutor::globalEvalWithSourceUrl(const Value *args, size_t count) {
       std::make_unique<StringBuffer>(std::move(code)), url);
 }
 
+namespace {
+
+// Below this many values, creating a payload through JSI is cheaper than
+// serializing it and calling into the JSON parser of the engine (see
+// tests/benchmarks/BridgePayloadBenchmark.cpp).
+constexpr size_t kMinJsonPayloadSize = 256;
+
+// Whether `payload` has at least `remaining` values. Counting stops there, so
+// this takes at most that many steps (and levels of recursion) however large
+// or deep the payload is.
+bool hasAtLeastValues(const folly::dynamic &payload, size_t &remaining) {
+  if (--remaining == 0) {
+    return true;
+  }
+  switch (payload.type()) {
+    case folly::dynamic::ARRAY:
+      for (const auto &element : payload) {
+        if (hasAtLeastValues(element, remaining)) {
+          return true;
+        }
+      }
+      break;
+    case folly::dynamic::OBJECT:
+      for (const auto &item : payload.items()) {
+        if (hasAtLeastValues(item.second, remaining)) {
+          return true;
+        }
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+} // namespace
+
+Value valueFromBridgePayload(Runtime &runtime, const folly::dynamic &payload) {
+  auto remaining = kMinJsonPayloadSize;
+  if (!hasAtLeastValues(payload, remaining)) {
+    return valueFromDynamic(runtime, payload);
+  }
+  SystraceSection s("valueFromBridgePayload::json");
+  auto options = folly::json::serialization_opts{};
+  options.validate_utf8 = true;
+  auto json = std::string{};
+  try {
+    json = folly::json::serialize(payload, options);
+  } catch (const std::exception &) {
+    // JSON can't represent the payload: it has NaN or Infinity, keys other
+    // than strings, or invalid UTF-8 (which the JSON parser of the engine
+    // would reject, or decode differently than `valueFromDynamic`).
+    return valueFromDynamic(runtime, payload);
+  }
+  return Value::createFromJsonUtf8(
+      runtime, reinterpret_cast<const uint8_t *>(json.data()), json.size());
+}
+
 void bindNativeLogger(Runtime &runtime, Logger logger) {
   runtime.global().setProperty(
       runtime,
@@ -579,5 +724,41 @@ void bindNativePerformanceNow(Runtime &runtime, PerformanceNow performanceNow) {
               size_t count) { return Value(performanceNow()); }));
 }
 
+void bindNativeTraceBuffer(Runtime &runtime) {
+  runtime.global().setProperty(
+      runtime,
+      "nativeTraceBufferSetEnabled",
+      Function::createFromHostFunction(
+          runtime,
+          PropNameID::forAscii(runtime, "nativeTraceBufferSetEnabled"),
+          1,
+          [](jsi::Runtime &runtime,
+             const jsi::Value &,
+             const jsi::Value *args,
+             size_t count) {
+            if (count != 1) {
+              throw std::invalid_argument(
+                  "nativeTraceBufferSetEnabled takes 1 argument");
+            }
+            TraceBuffer::setEnabled(args[0].asBool());
+            return Value::undefined();
+          }));
+
+  runtime.global().setProperty(
+      runtime,
+      "nativeTraceBufferToChromeTraceJson",
+      Function::createFromHostFunction(
+          runtime,
+          PropNameID::forAscii(runtime, "nativeTraceBufferToChromeTraceJson"),
+          0,
+          [](jsi::Runtime &runtime,
+             const jsi::Value &,
+             const jsi::Value *args,
+             size_t count) {
+            return jsi::String::createFromUtf8(
+                runtime, TraceBuffer::toChromeTraceJson());
+          }));
+}
+
 } // namespace react
 } // namespace facebook
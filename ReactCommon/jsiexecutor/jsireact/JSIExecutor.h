@@ -8,6 +8,7 @@
 #pragma once
 
 #include "JSINativeModules.h"
+#include "PreparedJavaScriptCache.h"
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSExecutor.h>
@@ -77,6 +78,7 @@ class JSIExecutor : public JSExecutor {
       std::shared_ptr<ExecutorDelegate> delegate,
       const JSIScopedTimeoutInvoker &timeoutInvoker,
       RuntimeInstaller runtimeInstaller);
+  ~JSIExecutor() override;
   void initializeRuntime() override;
   void loadBundle(
       std::unique_ptr<const JSBigString> script,
@@ -109,14 +111,25 @@ class JSIExecutor : public JSExecutor {
 
   void flush() override;
 
+  /*
+   * Bundles are prepared through `cache` from now on, so that they aren't
+   * parsed again when they are loaded again by a runtime sharing the cache.
+   */
+  void setPreparedJavaScriptCache(
+      std::shared_ptr<PreparedJavaScriptCache> cache);
+
  private:
   class NativeModuleProxy;
 
   void bindBridge();
   void callNativeModules(const jsi::Value &queue, bool isEndOfBatch);
+  std::vector<MethodCall> parseBinaryMethodCalls(const jsi::Array &queue);
   jsi::Value nativeCallSyncHook(const jsi::Value *args, size_t count);
   jsi::Value nativeRequire(const jsi::Value *args, size_t count);
   jsi::Value globalEvalWithSourceUrl(const jsi::Value *args, size_t count);
+  void evaluateBundle(
+      std::unique_ptr<const JSBigString> script,
+      const std::string &sourceURL);
 
   std::shared_ptr<jsi::Runtime> runtime_;
   std::shared_ptr<ExecutorDelegate> delegate_;
@@ -126,6 +139,7 @@ class JSIExecutor : public JSExecutor {
   std::unique_ptr<RAMBundleRegistry> bundleRegistry_;
   JSIScopedTimeoutInvoker scopedTimeoutInvoker_;
   RuntimeInstaller runtimeInstaller_;
+  std::shared_ptr<PreparedJavaScriptCache> preparedJavaScriptCache_;
 
   folly::Optional<jsi::Function> callFunctionReturnFlushedQueue_;
   folly::Optional<jsi::Function> invokeCallbackAndReturnFlushedQueue_;
@@ -136,9 +150,24 @@ using Logger =
     std::function<void(const std::string &message, unsigned int logLevel)>;
 void bindNativeLogger(jsi::Runtime &runtime, Logger logger);
 
+// Converts a value sent to JS over the bridge (arguments of calls, results of
+// synchronous methods, module configs). Large values are serialized to JSON
+// and parsed by the engine, which is cheaper than creating them value by value
+// through JSI. The result is the same as `valueFromDynamic`'s: values JSON
+// can't represent (NaN, Infinity, non-string keys, invalid UTF-8) are never
+// converted through JSON.
+jsi::Value valueFromBridgePayload(
+    jsi::Runtime &runtime,
+    const folly::dynamic &payload);
+
 using PerformanceNow = std::function<double()>;
 void bindNativePerformanceNow(
     jsi::Runtime &runtime,
     PerformanceNow performanceNow);
+
+// Installs `nativeTraceBufferSetEnabled(enabled)` and
+// `nativeTraceBufferToChromeTraceJson()`, which control the in-process
+// TraceBuffer (see reactperflogger/TraceBuffer.h) and return its events.
+void bindNativeTraceBuffer(jsi::Runtime &runtime);
 } // namespace react
 } // namespace facebook
@@ -12,7 +12,7 @@
 
 #include <cxxreact/ReactMarker.h>
 
-#include <jsi/JSIDynamic.h>
+#include "jsireact/JSIExecutor.h"
 
 #include <string>
 
@@ -68,11 +68,7 @@ void JSINativeModules::reset() {
 folly::Optional<Object> JSINativeModules::createModule(
     Runtime &rt,
     const std::string &name) {
-  bool hasLogger(ReactMarker::logTaggedMarker);
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
 
   if (!m_genNativeModuleJS) {
     m_genNativeModuleJS =
@@ -86,7 +82,7 @@ folly::Optional<Object> JSINativeModules::createModule(
 
   Value moduleInfo = m_genNativeModuleJS->call(
       rt,
-      valueFromDynamic(rt, result->config),
+      valueFromBridgePayload(rt, result->config),
       static_cast<double>(result->index));
   CHECK(!moduleInfo.isNull()) << "Module returned from genNativeModule is null";
   CHECK(moduleInfo.isObject())
@@ -95,10 +91,7 @@ folly::Optional<Object> JSINativeModules::createModule(
   folly::Optional<Object> module(
       moduleInfo.asObject(rt).getPropertyAsObject(rt, "module"));
 
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
 
   return module;
 }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PreparedJavaScriptCache.h"
+
+#include <cxxreact/SystraceSection.h>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+
+PreparedJavaScriptCache::PreparedJavaScriptCache(
+    size_t capacity,
+    BufferPredicate isCacheable)
+    : capacity_(capacity), isCacheable_(std::move(isCacheable)) {}
+
+std::shared_ptr<const jsi::PreparedJavaScript>
+PreparedJavaScriptCache::prepareJavaScript(
+    jsi::Runtime &runtime,
+    const std::shared_ptr<const jsi::Buffer> &buffer,
+    const std::string &sourceURL) {
+  if (capacity_ == 0 || (isCacheable_ && !isCacheable_(*buffer))) {
+    return runtime.prepareJavaScript(buffer, sourceURL);
+  }
+
+  size_t hash;
+  {
+    SystraceSection s("PreparedJavaScriptCache::hash");
+    hash = std::hash<std::string_view>{}(std::string_view(
+        reinterpret_cast<const char *>(buffer->data()), buffer->size()));
+  }
+  auto matches = [&](const Entry &entry) {
+    return entry.hash == hash && entry.buffer->size() == buffer->size() &&
+        entry.sourceURL == sourceURL &&
+        (entry.buffer == buffer ||
+         memcmp(entry.buffer->data(), buffer->data(), buffer->size()) == 0);
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto entry = entries_.begin(); entry != entries_.end(); entry++) {
+      if (matches(*entry)) {
+        entries_.splice(entries_.begin(), entries_, entry);
+        return entry->preparedJavaScript;
+      }
+    }
+  }
+
+  // Prepared without holding the lock, as this is the slow part. Two runtimes
+  // loading the same bundle at the same time may both prepare it.
+  auto preparedJavaScript = runtime.prepareJavaScript(buffer, sourceURL);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &entry : entries_) {
+    if (matches(entry)) {
+      return preparedJavaScript;
+    }
+  }
+  entries_.push_front({hash, buffer, sourceURL, preparedJavaScript});
+  if (entries_.size() > capacity_) {
+    entries_.pop_back();
+  }
+  return preparedJavaScript;
+}
+
+void PreparedJavaScriptCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+std::shared_ptr<PreparedJavaScriptCache> PreparedJavaScriptCache::getShared(
+    const std::string &runtimeKey,
+    size_t capacity,
+    BufferPredicate isCacheable) {
+  static std::mutex mutex;
+  // Leaked, as runtimes may still load bundles during static destruction.
+  static auto caches = new std::unordered_map<
+      std::string,
+      std::shared_ptr<PreparedJavaScriptCache>>();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto &cache = (*caches)[runtimeKey];
+  if (!cache) {
+    cache = std::make_shared<PreparedJavaScriptCache>(
+        capacity, std::move(isCacheable));
+  }
+  return cache;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Keeps the results of `jsi::Runtime::prepareJavaScript` for the most recently
+ * loaded bundles, keyed by their content and their source URL, so that loading
+ * the same bundle again (on reload, in another instance or in a secondary
+ * runtime) skips parsing and compiling it.
+ *
+ * Prepared scripts can only be evaluated by runtimes of the engine which
+ * prepared them, so a cache must only be shared between runtimes of the same
+ * engine (see `getShared`). Thread-safe.
+ */
+class PreparedJavaScriptCache {
+ public:
+  using BufferPredicate = std::function<bool(const jsi::Buffer &buffer)>;
+
+  /*
+   * `isCacheable` allows to skip buffers for which preparing is cheap (e.g.
+   * precompiled bytecode), as they would be hashed for nothing.
+   */
+  explicit PreparedJavaScriptCache(
+      size_t capacity = 4,
+      BufferPredicate isCacheable = nullptr);
+
+  std::shared_ptr<const jsi::PreparedJavaScript> prepareJavaScript(
+      jsi::Runtime &runtime,
+      const std::shared_ptr<const jsi::Buffer> &buffer,
+      const std::string &sourceURL);
+
+  void clear();
+
+  /*
+   * Returns the cache of the process for the runtimes identified by
+   * `runtimeKey`, which is created with `capacity` and `isCacheable` the first
+   * time. Executor factories are created again by every bridge and on every
+   * reload, so they get their cache here rather than own it. `runtimeKey` must
+   * identify the engine and all the settings which change what it prepares.
+   */
+  static std::shared_ptr<PreparedJavaScriptCache> getShared(
+      const std::string &runtimeKey,
+      size_t capacity = 4,
+      BufferPredicate isCacheable = nullptr);
+
+ private:
+  struct Entry {
+    // Only a prefilter: the content is compared when the hashes match.
+    size_t hash;
+    std::shared_ptr<const jsi::Buffer> buffer;
+    std::string sourceURL;
+    std::shared_ptr<const jsi::PreparedJavaScript> preparedJavaScript;
+  };
+
+  const size_t capacity_;
+  const BufferPredicate isCacheable_;
+  std::mutex mutex_;
+  // Most recently used first.
+  std::list<Entry> entries_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsireact/JSIExecutor.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+constexpr const char *kIsIdentical = R"JS((function isIdentical(a, b) {
+  if (typeof a !== 'object' || a === null ||
+      typeof b !== 'object' || b === null) {
+    return Object.is(a, b);
+  }
+  if (Array.isArray(a) !== Array.isArray(b)) {
+    return false;
+  }
+  var aKeys = Object.keys(a);
+  var bKeys = Object.keys(b);
+  if (aKeys.length !== bKeys.length) {
+    return false;
+  }
+  for (var i = 0; i < aKeys.length; i++) {
+    if (aKeys[i] !== bKeys[i] || !isIdentical(a[aKeys[i]], b[bKeys[i]])) {
+      return false;
+    }
+  }
+  return true;
+}))JS";
+
+class BridgePayloadTest : public ::testing::Test {
+ protected:
+  BridgePayloadTest()
+      : runtime_(facebook::hermes::makeHermesRuntime()), rt_(*runtime_) {}
+
+  // Whether `a` and `b` are the same JS values: same primitives (according
+  // to `Object.is`), and same properties in the same order.
+  bool areIdentical(const jsi::Value &a, const jsi::Value &b) {
+    auto isIdentical = rt_.global()
+                           .getPropertyAsFunction(rt_, "eval")
+                           .call(rt_, kIsIdentical)
+                           .getObject(rt_)
+                           .getFunction(rt_);
+    return isIdentical.call(rt_, a, b).getBool();
+  }
+
+  // Returns `values` padded with enough values to be converted through JSON
+  // when it's representable in JSON.
+  static folly::dynamic makeLarge(folly::dynamic values) {
+    auto padding = folly::dynamic::array();
+    for (int i = 0; i < 300; i++) {
+      padding.push_back(i);
+    }
+    return folly::dynamic::array(std::move(values), std::move(padding));
+  }
+
+  void expectSameAsValueFromDynamic(const folly::dynamic &payload) {
+    EXPECT_TRUE(areIdentical(
+        jsi::valueFromDynamic(rt_, payload),
+        valueFromBridgePayload(rt_, payload)))
+        << payload;
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  jsi::Runtime &rt_;
+};
+
+TEST_F(BridgePayloadTest, smallPayloads) {
+  expectSameAsValueFromDynamic(nullptr);
+  expectSameAsValueFromDynamic(42);
+  expectSameAsValueFromDynamic("string");
+  expectSameAsValueFromDynamic(folly::dynamic::object("a", 1)("b", "c"));
+}
+
+TEST_F(BridgePayloadTest, largePayloads) {
+  folly::dynamic values = folly::dynamic::object("string", "é中😀");
+  values["double"] = 0.1;
+  values["negativeZero"] = -0.0;
+  values["bool"] = false;
+  values["null"] = nullptr;
+  values["nested"] = folly::dynamic::object("b", 2)("a", 1);
+  values["1"] = "numeric string key";
+  values["0"] = "ordered before other keys";
+  expectSameAsValueFromDynamic(makeLarge(std::move(values)));
+}
+
+TEST_F(BridgePayloadTest, int64) {
+  expectSameAsValueFromDynamic(makeLarge(folly::dynamic::array(
+      std::numeric_limits<int64_t>::max(),
+      std::numeric_limits<int64_t>::min(),
+      (int64_t{1} << 53) + 1,
+      -(int64_t{1} << 53) - 1)));
+}
+
+TEST_F(BridgePayloadTest, nanAndInfinity) {
+  expectSameAsValueFromDynamic(makeLarge(folly::dynamic::array(
+      std::numeric_limits<double>::quiet_NaN(),
+      std::numeric_limits<double>::infinity(),
+      -std::numeric_limits<double>::infinity())));
+}
+
+TEST_F(BridgePayloadTest, nonStringKeys) {
+  expectSameAsValueFromDynamic(makeLarge(
+      folly::dynamic::object(1, "int")(2.5, "double")(true, "bool")(
+          "string", "string")));
+}
+
+TEST_F(BridgePayloadTest, invalidUtf8) {
+  expectSameAsValueFromDynamic(
+      makeLarge(folly::dynamic::array("valid", "invalid \xff\xfe")));
+  expectSameAsValueFromDynamic(
+      makeLarge(folly::dynamic::object("invalid \xc3", "key")));
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/decorator.h>
+#include <jsireact/PreparedJavaScriptCache.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+struct FakePreparedJavaScript : public jsi::PreparedJavaScript {};
+
+/*
+ * Counts the calls to `prepareJavaScript`, which returns a new fake prepared
+ * script each time. Optionally waits until `concurrentCalls` calls are in
+ * progress before returning.
+ */
+class CountingRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
+ public:
+  explicit CountingRuntime(
+      std::unique_ptr<jsi::Runtime> plain,
+      size_t concurrentCalls = 1)
+      : RuntimeDecorator(*plain),
+        plain_(std::move(plain)),
+        concurrentCalls_(concurrentCalls) {}
+
+  std::shared_ptr<const jsi::PreparedJavaScript> prepareJavaScript(
+      const std::shared_ptr<const jsi::Buffer> &,
+      std::string) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    calls_++;
+    condition_.notify_all();
+    condition_.wait_for(lock, std::chrono::seconds(10), [this] {
+      return calls_ >= concurrentCalls_;
+    });
+    return std::make_shared<FakePreparedJavaScript>();
+  }
+
+  size_t getCalls() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return calls_;
+  }
+
+ private:
+  std::unique_ptr<jsi::Runtime> plain_;
+  const size_t concurrentCalls_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  size_t calls_{0};
+};
+
+std::shared_ptr<const jsi::Buffer> makeBuffer(std::string script) {
+  return std::make_shared<jsi::StringBuffer>(std::move(script));
+}
+
+} // namespace
+
+TEST(PreparedJavaScriptCacheTest, HitsAndMisses) {
+  CountingRuntime runtime(hermes::makeHermesRuntime());
+  PreparedJavaScriptCache cache;
+
+  auto prepared = cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  EXPECT_EQ(1, runtime.getCalls());
+
+  // Same content in a different buffer.
+  EXPECT_EQ(
+      prepared, cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(1, runtime.getCalls());
+
+  EXPECT_NE(
+      prepared, cache.prepareJavaScript(runtime, makeBuffer("a()"), "b.js"));
+  EXPECT_EQ(2, runtime.getCalls());
+  EXPECT_NE(
+      prepared, cache.prepareJavaScript(runtime, makeBuffer("b()"), "a.js"));
+  EXPECT_EQ(3, runtime.getCalls());
+
+  cache.clear();
+  EXPECT_NE(
+      prepared, cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(4, runtime.getCalls());
+}
+
+TEST(PreparedJavaScriptCacheTest, EvictsLeastRecentlyUsed) {
+  CountingRuntime runtime(hermes::makeHermesRuntime());
+  PreparedJavaScriptCache cache(2);
+
+  auto a = cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  auto b = cache.prepareJavaScript(runtime, makeBuffer("b()"), "b.js");
+  EXPECT_EQ(a, cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(2, runtime.getCalls());
+
+  // Evicts `b`, which is now the least recently used.
+  cache.prepareJavaScript(runtime, makeBuffer("c()"), "c.js");
+  EXPECT_EQ(3, runtime.getCalls());
+  EXPECT_EQ(a, cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(3, runtime.getCalls());
+  EXPECT_NE(b, cache.prepareJavaScript(runtime, makeBuffer("b()"), "b.js"));
+  EXPECT_EQ(4, runtime.getCalls());
+}
+
+TEST(PreparedJavaScriptCacheTest, SkipsBuffersWhichAreNotCacheable) {
+  CountingRuntime runtime(hermes::makeHermesRuntime());
+  PreparedJavaScriptCache cache(4, [](const jsi::Buffer &buffer) {
+    return buffer.size() == 0 || buffer.data()[0] != '#';
+  });
+
+  auto prepared =
+      cache.prepareJavaScript(runtime, makeBuffer("#bytecode"), "a.js");
+  EXPECT_NE(
+      prepared,
+      cache.prepareJavaScript(runtime, makeBuffer("#bytecode"), "a.js"));
+  EXPECT_EQ(2, runtime.getCalls());
+
+  prepared = cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  EXPECT_EQ(
+      prepared, cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(3, runtime.getCalls());
+
+  PreparedJavaScriptCache disabledCache(0);
+  disabledCache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  disabledCache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  EXPECT_EQ(5, runtime.getCalls());
+}
+
+TEST(PreparedJavaScriptCacheTest, KeepsOneOfConcurrentlyPreparedScripts) {
+  // Both threads miss, and prepare the script at the same time.
+  CountingRuntime runtime(hermes::makeHermesRuntime(), 2);
+  PreparedJavaScriptCache cache;
+
+  std::shared_ptr<const jsi::PreparedJavaScript> first;
+  std::shared_ptr<const jsi::PreparedJavaScript> second;
+  std::thread thread([&] {
+    first = cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  });
+  second = cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  thread.join();
+  ASSERT_EQ(2, runtime.getCalls());
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, second);
+
+  auto cached = cache.prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  EXPECT_EQ(2, runtime.getCalls());
+  EXPECT_TRUE(cached == first || cached == second);
+}
+
+TEST(PreparedJavaScriptCacheTest, SharesCachesOfSameRuntimeKey) {
+  CountingRuntime runtime(hermes::makeHermesRuntime());
+
+  // Like the caches of two executor factories (e.g. before and after a
+  // reload) which create runtimes with the same config.
+  auto cache = PreparedJavaScriptCache::getShared("SharesCaches:a");
+  auto otherCache = PreparedJavaScriptCache::getShared("SharesCaches:a");
+  EXPECT_EQ(cache, otherCache);
+
+  auto prepared = cache->prepareJavaScript(runtime, makeBuffer("a()"), "a.js");
+  EXPECT_EQ(
+      prepared,
+      otherCache->prepareJavaScript(runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(1, runtime.getCalls());
+
+  auto cacheOfOtherConfig =
+      PreparedJavaScriptCache::getShared("SharesCaches:b");
+  EXPECT_NE(cache, cacheOfOtherConfig);
+  EXPECT_NE(
+      prepared,
+      cacheOfOtherConfig->prepareJavaScript(
+          runtime, makeBuffer("a()"), "a.js"));
+  EXPECT_EQ(2, runtime.getCalls());
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/json.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsireact/JSIExecutor.h>
+
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+/*
+ * An array of module-constant-like objects with about `numberOfValues` values
+ * in total (which is what `kMinJsonPayloadSize` is compared with).
+ */
+folly::dynamic makePayload(size_t numberOfValues) {
+  auto payload = folly::dynamic::array();
+  size_t size = 1;
+  for (int i = 0; size < numberOfValues; i++) {
+    payload.push_back(
+        folly::dynamic::object("name", "constant" + std::to_string(i))(
+            "value", i)("enabled", i % 2 == 0));
+    size += 4;
+  }
+  return payload;
+}
+
+} // namespace
+
+static void bridgePayloadThroughJsi(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto payload = makePayload(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::valueFromDynamic(*runtime, payload));
+  }
+}
+BENCHMARK(bridgePayloadThroughJsi)->RangeMultiplier(4)->Range(16, 4096);
+
+static void bridgePayloadThroughJson(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto payload = makePayload(state.range(0));
+  for (auto _ : state) {
+    auto json = folly::toJson(payload);
+    benchmark::DoNotOptimize(jsi::Value::createFromJsonUtf8(
+        *runtime,
+        reinterpret_cast<const uint8_t *>(json.data()),
+        json.size()));
+  }
+}
+BENCHMARK(bridgePayloadThroughJson)->RangeMultiplier(4)->Range(16, 4096);
+
+/*
+ * What the bridge does: whichever of the above `kMinJsonPayloadSize` selects.
+ */
+static void bridgePayload(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto payload = makePayload(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(valueFromBridgePayload(*runtime, payload));
+  }
+}
+BENCHMARK(bridgePayload)->RangeMultiplier(4)->Range(16, 4096);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -10,6 +10,7 @@
 #include <react/bridging/AString.h>
 #include <react/bridging/Array.h>
 #include <react/bridging/Bool.h>
+#include <react/bridging/Buffer.h>
 #include <react/bridging/Class.h>
 #include <react/bridging/Error.h>
 #include <react/bridging/Function.h>
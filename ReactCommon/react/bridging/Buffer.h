@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/bridging/Base.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A `std::span`-like view of the memory of a JavaScript `ArrayBuffer`, typed
+ * array (e.g. `Uint8Array` or `Float32Array`) or `DataView`, passed to native
+ * code without copying.
+ * The view does not retain the JavaScript object; it must only be used
+ * synchronously, on the JavaScript thread, during the call it was passed to.
+ */
+template <typename T>
+class BufferView {
+  static_assert(
+      std::is_arithmetic_v<T>,
+      "BufferView can only be used with arithmetic types");
+
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = size_t;
+  using iterator = T *;
+
+  BufferView() = default;
+  BufferView(T *data, size_t size) : data_(data), size_(size) {}
+
+  T *data() const {
+    return data_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  size_t size_bytes() const {
+    return size_ * sizeof(T);
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  T &operator[](size_t index) const {
+    return data_[index];
+  }
+
+  iterator begin() const {
+    return data_;
+  }
+
+  iterator end() const {
+    return data_ + size_;
+  }
+
+ private:
+  T *data_{nullptr};
+  size_t size_{0};
+};
+
+/*
+ * Native-allocated bytes which can be moved into a JavaScript `ArrayBuffer`
+ * without copying: `bridging::toJs(rt, std::make_shared<VectorBuffer>(...))`.
+ */
+class VectorBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorBuffer(std::vector<uint8_t> bytes)
+      : bytes_(std::move(bytes)) {}
+
+  size_t size() const override {
+    return bytes_.size();
+  }
+
+  uint8_t *data() override {
+    return bytes_.data();
+  }
+
+ private:
+  std::vector<uint8_t> bytes_;
+};
+
+template <typename T>
+struct Bridging<BufferView<T>> {
+  static BufferView<T> fromJs(jsi::Runtime &rt, const jsi::Object &value) {
+    if (value.isArrayBuffer(rt)) {
+      auto arrayBuffer = value.getArrayBuffer(rt);
+      return makeView(
+          rt, arrayBuffer.data(rt), arrayBuffer.size(rt), "ArrayBuffer");
+    }
+
+    // Typed arrays and `DataView`s expose the `ArrayBuffer` they are backed
+    // by and the region of it they cover.
+    auto buffer = value.getProperty(rt, "buffer");
+    if (!buffer.isObject() || !buffer.getObject(rt).isArrayBuffer(rt)) {
+      throw jsi::JSError(rt, "Value is not an ArrayBuffer or a typed array");
+    }
+
+    // The properties are read from an arbitrary object, so they are checked
+    // against the size of the buffer rather than trusted.
+    auto arrayBuffer = buffer.getObject(rt).getArrayBuffer(rt);
+    auto bufferSize = arrayBuffer.size(rt);
+    auto byteOffset = getByteCount(rt, value, "byteOffset", bufferSize);
+    auto byteLength = getByteCount(rt, value, "byteLength", bufferSize);
+    if (byteLength > bufferSize - byteOffset) {
+      throw jsi::JSError(
+          rt, "The region of the typed array exceeds the size of its buffer");
+    }
+    return makeView(
+        rt, arrayBuffer.data(rt) + byteOffset, byteLength, "typed array");
+  }
+
+ private:
+  /*
+   * Returns the value of the property `name` of `value` if it's an integer
+   * between 0 and `bufferSize`.
+   */
+  static size_t getByteCount(
+      jsi::Runtime &rt,
+      const jsi::Object &value,
+      const char *name,
+      size_t bufferSize) {
+    auto property = value.getProperty(rt, name);
+    // Also false for NaN.
+    if (!property.isNumber() || !(property.getNumber() >= 0) ||
+        property.getNumber() > static_cast<double>(bufferSize) ||
+        property.getNumber() != std::floor(property.getNumber())) {
+      throw jsi::JSError(
+          rt,
+          std::string{"The "} + name +
+              " of the typed array is not a valid index of its buffer");
+    }
+    return static_cast<size_t>(property.getNumber());
+  }
+
+  static BufferView<T> makeView(
+      jsi::Runtime &rt,
+      uint8_t *data,
+      size_t byteLength,
+      char const *kind) {
+    if (byteLength % sizeof(T) != 0) {
+      throw jsi::JSError(
+          rt,
+          std::string{"The byte length of the "} + kind +
+              " is not a multiple of the size of the element type");
+    }
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+      throw jsi::JSError(
+          rt,
+          std::string{"The memory of the "} + kind +
+              " is not aligned to the alignment of the element type");
+    }
+    return BufferView<T>{reinterpret_cast<T *>(data), byteLength / sizeof(T)};
+  }
+};
+
+template <typename T>
+struct Bridging<
+    std::shared_ptr<T>,
+    std::enable_if_t<std::is_base_of_v<jsi::MutableBuffer, T>>> {
+  static jsi::ArrayBuffer toJs(jsi::Runtime &rt, std::shared_ptr<T> buffer) {
+    return jsi::ArrayBuffer(rt, std::move(buffer));
+  }
+};
+
+} // namespace facebook::react
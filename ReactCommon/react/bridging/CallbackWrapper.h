@@ -22,25 +22,10 @@ class CallbackWrapper : public LongLivedObject {
       jsi::Function &&callback,
       jsi::Runtime &runtime,
       std::shared_ptr<CallInvoker> jsInvoker)
-      : longLivedObjectCollection_(),
-        callback_(std::move(callback)),
+      : callback_(std::move(callback)),
         runtime_(runtime),
         jsInvoker_(std::move(jsInvoker)) {}
 
-  CallbackWrapper(
-      std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection,
-      jsi::Function &&callback,
-      jsi::Runtime &runtime,
-      std::shared_ptr<CallInvoker> jsInvoker)
-      : longLivedObjectCollection_(longLivedObjectCollection),
-        callback_(std::move(callback)),
-        runtime_(runtime),
-        jsInvoker_(std::move(jsInvoker)) {}
-
-  // Use a weak_ptr to avoid a retain cycle: LongLivedObjectCollection owns all
-  // CallbackWrappers. So, CallbackWrapper cannot own its
-  // LongLivedObjectCollection.
-  std::weak_ptr<LongLivedObjectCollection> longLivedObjectCollection_;
   jsi::Function callback_;
   jsi::Runtime &runtime_;
   std::shared_ptr<CallInvoker> jsInvoker_;
@@ -52,7 +37,7 @@ class CallbackWrapper : public LongLivedObject {
       std::shared_ptr<CallInvoker> jsInvoker) {
     auto wrapper = std::shared_ptr<CallbackWrapper>(
         new CallbackWrapper(std::move(callback), runtime, jsInvoker));
-    LongLivedObjectCollection::get().add(wrapper);
+    LongLivedObjectCollection::get(runtime).add(wrapper);
     return wrapper;
   }
 
@@ -61,8 +46,8 @@ class CallbackWrapper : public LongLivedObject {
       jsi::Function &&callback,
       jsi::Runtime &runtime,
       std::shared_ptr<CallInvoker> jsInvoker) {
-    auto wrapper = std::shared_ptr<CallbackWrapper>(new CallbackWrapper(
-        longLivedObjectCollection, std::move(callback), runtime, jsInvoker));
+    auto wrapper = std::shared_ptr<CallbackWrapper>(
+        new CallbackWrapper(std::move(callback), runtime, jsInvoker));
     longLivedObjectCollection->add(wrapper);
     return wrapper;
   }
@@ -87,16 +72,6 @@ class CallbackWrapper : public LongLivedObject {
   std::shared_ptr<CallInvoker> jsInvokerPtr() {
     return jsInvoker_;
   }
-
-  void allowRelease() override {
-    if (auto longLivedObjectCollection = longLivedObjectCollection_.lock()) {
-      if (longLivedObjectCollection != nullptr) {
-        longLivedObjectCollection->remove(this);
-        return;
-      }
-    }
-    LongLivedObject::allowRelease();
-  }
 };
 
 } // namespace react
@@ -36,6 +36,15 @@ inline constexpr bool is_optional_v = is_optional<T>::value;
 template <typename T>
 struct Converter;
 
+// Unlike `jsi::Object::getArrayBuffer`, throws if the object is not an
+// `ArrayBuffer` (same as `jsi::Object::asArray` for arrays).
+inline jsi::ArrayBuffer asArrayBuffer(jsi::Runtime &rt, jsi::Object &&object) {
+  if (!object.isArrayBuffer(rt)) {
+    throw jsi::JSError(rt, "Object is not an ArrayBuffer");
+  }
+  return std::move(object).getArrayBuffer(rt);
+}
+
 template <typename T>
 struct ConverterBase {
   using BaseT = remove_cvref_t<T>;
@@ -58,6 +67,8 @@ struct ConverterBase {
         return std::move(value).getObject(rt_).getArray(rt_);
       } else if constexpr (std::is_same_v<BaseT, jsi::Function>) {
         return std::move(value).getObject(rt_).getFunction(rt_);
+      } else if constexpr (std::is_same_v<BaseT, jsi::ArrayBuffer>) {
+        return std::move(value).getObject(rt_).getArrayBuffer(rt_);
       }
     } else {
       return std::move(value_);
@@ -109,6 +120,10 @@ struct Converter<jsi::Value> : public ConverterBase<jsi::Value> {
   operator jsi::Function() && {
     return std::move(value_).asObject(rt_).asFunction(rt_);
   }
+
+  operator jsi::ArrayBuffer() && {
+    return asArrayBuffer(rt_, std::move(value_).asObject(rt_));
+  }
 };
 
 template <>
@@ -122,6 +137,10 @@ struct Converter<jsi::Object> : public ConverterBase<jsi::Object> {
   operator jsi::Function() && {
     return std::move(value_).asFunction(rt_);
   }
+
+  operator jsi::ArrayBuffer() && {
+    return asArrayBuffer(rt_, std::move(value_));
+  }
 };
 
 template <typename T>
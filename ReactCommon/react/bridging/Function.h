@@ -44,10 +44,10 @@ class AsyncCallback {
 
     auto argsTuple = std::make_tuple(std::forward<Args>(args)...);
 
-    wrapper->jsInvoker().invokeAsync(
-        [callback = callback_,
-         argsPtr = std::make_shared<decltype(argsTuple)>(
-             std::move(argsTuple))] { callback->apply(std::move(*argsPtr)); });
+    wrapper->jsInvoker().invokeAsyncTask(
+        [callback = callback_, argsTuple = std::move(argsTuple)]() mutable {
+          callback->apply(std::move(argsTuple));
+        });
   }
 
  private:
@@ -7,43 +7,123 @@
 
 #include "LongLivedObject.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace facebook {
 namespace react {
 
+namespace {
+
+struct RuntimeCollections {
+  std::mutex mutex;
+  std::unordered_map<
+      jsi::Runtime const *,
+      std::shared_ptr<LongLivedObjectCollection>>
+      collections;
+};
+
+RuntimeCollections &runtimeCollections() {
+  static RuntimeCollections instance;
+  return instance;
+}
+
+} // namespace
+
 // LongLivedObjectCollection
 LongLivedObjectCollection &LongLivedObjectCollection::get() {
-  static LongLivedObjectCollection instance;
-  return instance;
+  // Held by a `shared_ptr` so that objects can refer to it weakly.
+  static auto instance = std::make_shared<LongLivedObjectCollection>();
+  return *instance;
+}
+
+LongLivedObjectCollection &LongLivedObjectCollection::get(
+    jsi::Runtime &runtime) {
+  auto &registry = runtimeCollections();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto &collection = registry.collections[&runtime];
+  if (!collection) {
+    collection = std::make_shared<LongLivedObjectCollection>();
+  }
+  return *collection;
+}
+
+void LongLivedObjectCollection::discard(jsi::Runtime &runtime) {
+  auto collection = std::shared_ptr<LongLivedObjectCollection>{};
+  {
+    auto &registry = runtimeCollections();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.collections.find(&runtime);
+    if (it == registry.collections.end()) {
+      return;
+    }
+    collection = std::move(it->second);
+    registry.collections.erase(it);
+  }
+
+  // Objects are released outside of the registry lock since their
+  // destructors may use collections.
+  collection->clear();
 }
 
 LongLivedObjectCollection::LongLivedObjectCollection() {}
 
+LongLivedObjectCollection::Shard &LongLivedObjectCollection::shardFor(
+    const LongLivedObject *o) const {
+  // The lowest bits are always the same because of the alignment.
+  auto address = reinterpret_cast<uintptr_t>(o);
+  return shards_[((address >> 4) ^ (address >> 12)) % kNumberOfShards];
+}
+
 void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  collection_.insert(so);
+  auto &shard = shardFor(so.get());
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (so->index_ < shard.objects.size() && shard.objects[so->index_] == so) {
+    return;
+  }
+  so->collection_ = weak_from_this();
+  so->index_ = shard.objects.size();
+  shard.objects.push_back(std::move(so));
 }
 
 void LongLivedObjectCollection::remove(const LongLivedObject *o) const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  auto p = collection_.begin();
-  for (; p != collection_.end(); p++) {
-    if (p->get() == o) {
-      break;
+  auto &shard = shardFor(o);
+
+  // Destroyed outside of the lock since its destructor may use collections.
+  auto removedObject = std::shared_ptr<LongLivedObject>{};
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto index = o->index_;
+    if (index >= shard.objects.size() || shard.objects[index].get() != o) {
+      return;
     }
-  }
-  if (p != collection_.end()) {
-    collection_.erase(p);
+
+    removedObject = std::move(shard.objects[index]);
+    if (index != shard.objects.size() - 1) {
+      shard.objects[index] = std::move(shard.objects.back());
+      shard.objects[index]->index_ = index;
+    }
+    shard.objects.pop_back();
   }
 }
 
 void LongLivedObjectCollection::clear() const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  collection_.clear();
+  for (auto &shard : shards_) {
+    auto objects = std::vector<std::shared_ptr<LongLivedObject>>{};
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      objects.swap(shard.objects);
+    }
+  }
 }
 
 size_t LongLivedObjectCollection::size() const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  return collection_.size();
+  size_t size = 0;
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.objects.size();
+  }
+  return size;
 }
 
 // LongLivedObject
@@ -51,7 +131,9 @@ LongLivedObject::LongLivedObject() {}
 LongLivedObject::~LongLivedObject() {}
 
 void LongLivedObject::allowRelease() {
-  LongLivedObjectCollection::get().remove(this);
+  if (auto collection = collection_.lock()) {
+    collection->remove(this);
+  }
 }
 
 } // namespace react
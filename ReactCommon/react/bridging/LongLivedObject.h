@@ -7,13 +7,19 @@
 
 #pragma once
 
+#include <jsi/jsi.h>
+
+#include <array>
+#include <limits>
 #include <memory>
 #include <mutex>
-#include <unordered_set>
+#include <vector>
 
 namespace facebook {
 namespace react {
 
+class LongLivedObjectCollection;
+
 /**
  * A simple wrapper class that can be registered to a collection that keep it
  * alive for extended period of time. This object can be removed from the
@@ -31,15 +37,47 @@ class LongLivedObject {
  protected:
   LongLivedObject();
   virtual ~LongLivedObject();
+
+ private:
+  friend class LongLivedObjectCollection;
+
+  /*
+   * The collection the object was added to and the position of the object in
+   * there, which make removal O(1). An object belongs to a single collection
+   * at a time. `index_` is protected by the mutex of the collection shard
+   * which holds the object.
+   */
+  std::weak_ptr<LongLivedObjectCollection const> collection_;
+  size_t index_{std::numeric_limits<size_t>::max()};
 };
 
 /**
- * A singleton, thread-safe, write-only collection for the `LongLivedObject`s.
+ * A thread-safe, write-only collection for the `LongLivedObject`s.
+ * Objects are spread over several independently locked shards, so concurrent
+ * additions and removals (e.g. of promises settled on different threads)
+ * rarely contend.
  */
-class LongLivedObjectCollection {
+class LongLivedObjectCollection
+    : public std::enable_shared_from_this<LongLivedObjectCollection> {
  public:
+  /*
+   * The process-wide collection.
+   */
   static LongLivedObjectCollection &get();
 
+  /*
+   * The collection of objects which belong to the given runtime. Unlike the
+   * process-wide one, it does not keep objects of other runtimes alive and is
+   * released together with its objects by `discard` when the runtime goes
+   * away.
+   */
+  static LongLivedObjectCollection &get(jsi::Runtime &runtime);
+
+  /*
+   * Releases the collection of the given runtime (if any) and its objects.
+   */
+  static void discard(jsi::Runtime &runtime);
+
   LongLivedObjectCollection();
   LongLivedObjectCollection(LongLivedObjectCollection const &) = delete;
   void operator=(LongLivedObjectCollection const &) = delete;
@@ -50,8 +88,16 @@ class LongLivedObjectCollection {
   size_t size() const;
 
  private:
-  mutable std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
-  mutable std::mutex collectionMutex_;
+  static constexpr size_t kNumberOfShards = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<LongLivedObject>> objects;
+  };
+
+  Shard &shardFor(const LongLivedObject *o) const;
+
+  mutable std::array<Shard, kNumberOfShards> shards_;
 };
 
 } // namespace react
@@ -13,6 +13,7 @@
 #include <butter/map.h>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 namespace facebook::react {
 
@@ -68,16 +69,18 @@ struct Bridging {
       jsi::Runtime &rt,
       const T &map,
       const std::shared_ptr<CallInvoker> &jsInvoker) {
-    auto resultObject = jsi::Object(rt);
+    std::vector<jsi::PropNameID> names;
+    std::vector<jsi::Value> values;
+    names.reserve(map.size());
+    values.reserve(map.size());
 
     for (const auto &[key, value] : map) {
-      resultObject.setProperty(
-          rt,
-          jsi::PropNameID::forUtf8(rt, key),
-          bridging::toJs(rt, value, jsInvoker));
+      names.push_back(jsi::PropNameID::forUtf8(rt, key));
+      values.emplace_back(bridging::toJs(rt, value, jsInvoker));
     }
 
-    return resultObject;
+    return jsi::Object::createWithProperties(
+        rt, names.data(), values.data(), names.size());
   }
 };
 
@@ -35,7 +35,7 @@ class AsyncPromise {
             jsInvoker));
 
     auto promiseHolder = std::make_shared<PromiseHolder>(promise.asObject(rt));
-    LongLivedObjectCollection::get().add(promiseHolder);
+    LongLivedObjectCollection::get(rt).add(promiseHolder);
 
     // The shared state can retain the promise holder weakly now.
     state_->promiseHolder = promiseHolder;
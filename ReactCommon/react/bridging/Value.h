@@ -66,7 +66,9 @@ struct Bridging<std::optional<T>> {
 template <typename T>
 struct Bridging<
     std::shared_ptr<T>,
-    std::enable_if_t<!std::is_base_of_v<jsi::HostObject, T>>> {
+    std::enable_if_t<
+        !std::is_base_of_v<jsi::HostObject, T> &&
+        !std::is_base_of_v<jsi::MutableBuffer, T>>> {
   static jsi::Value toJs(
       jsi::Runtime &rt,
       const std::shared_ptr<T> &ptr,
@@ -174,6 +174,74 @@ TEST_F(BridgingTest, arrayTest) {
       bridging::toJs(rt, std::initializer_list<int>{1, 2}, invoker).size(rt));
 }
 
+TEST_F(BridgingTest, bufferTest) {
+  auto bytes = eval("new Uint8Array([1, 2, 3, 4, 5, 6, 7, 8])");
+  auto arrayBuffer = eval("new Uint8Array([1, 2, 3, 4]).buffer");
+  auto subarray = eval("new Uint8Array([1, 2, 3, 4]).subarray(1, 3)");
+
+  auto view = bridging::fromJs<BufferView<uint8_t>>(rt, bytes, invoker);
+  ASSERT_EQ(8, view.size());
+  EXPECT_EQ(1, view[0]);
+  EXPECT_EQ(8, view[7]);
+
+  // The view refers to the memory of the JavaScript object.
+  view[0] = 42;
+  EXPECT_EQ(42, bytes.asObject(rt).getProperty(rt, "0").asNumber());
+
+  EXPECT_EQ(
+      4,
+      bridging::fromJs<BufferView<uint8_t>>(rt, arrayBuffer, invoker).size());
+  EXPECT_EQ(
+      2, bridging::fromJs<BufferView<uint32_t>>(rt, bytes, invoker).size());
+
+  auto subview = bridging::fromJs<BufferView<uint8_t>>(rt, subarray, invoker);
+  ASSERT_EQ(2, subview.size());
+  EXPECT_EQ(2, subview[0]);
+  EXPECT_EQ(3, subview[1]);
+
+  EXPECT_JSI_THROW(
+      bridging::fromJs<BufferView<uint32_t>>(rt, subarray, invoker));
+  EXPECT_JSI_THROW(bridging::fromJs<BufferView<uint8_t>>(
+      rt, jsi::Array::createWithElements(rt, 1, 2), invoker));
+
+  // Objects posing as typed arrays must describe a region of their buffer.
+  for (auto region :
+       {"byteOffset: 0, byteLength: 5",
+        "byteOffset: 4, byteLength: 1",
+        "byteOffset: 2, byteLength: 3",
+        "byteOffset: -1, byteLength: 1",
+        "byteOffset: 0.5, byteLength: 1",
+        "byteOffset: NaN, byteLength: 1",
+        "byteOffset: Infinity, byteLength: 1",
+        "byteOffset: 0, byteLength: -Infinity",
+        "byteOffset: 0, byteLength: '1'",
+        "byteOffset: 2 ** 64 - 1, byteLength: 2",
+        "byteOffset: 1, byteLength: 2 ** 64 - 1"}) {
+    auto object =
+        eval(std::string{"({buffer: new ArrayBuffer(4), "} + region + "})");
+    EXPECT_JSI_THROW(bridging::fromJs<BufferView<uint8_t>>(rt, object, invoker))
+        << region;
+  }
+  EXPECT_EQ(
+      1,
+      bridging::fromJs<BufferView<uint8_t>>(
+          rt,
+          eval("({buffer: new ArrayBuffer(4), byteOffset: 3, byteLength: 1})"),
+          invoker)
+          .size());
+
+  EXPECT_NO_THROW(bridging::fromJs<jsi::ArrayBuffer>(rt, arrayBuffer, invoker));
+  EXPECT_JSI_THROW(bridging::fromJs<jsi::ArrayBuffer>(rt, bytes, invoker));
+
+  auto buffer = std::make_shared<VectorBuffer>(std::vector<uint8_t>{1, 2, 3});
+  auto data = buffer->data();
+  auto result = bridging::toJs(rt, buffer, invoker);
+
+  // The native memory is moved into the `ArrayBuffer` without a copy.
+  EXPECT_EQ(3, result.size(rt));
+  EXPECT_EQ(data, result.data(rt));
+}
+
 TEST_F(BridgingTest, functionTest) {
   auto object = jsi::Object(rt);
   object.setProperty(rt, "foo", "bar");
@@ -377,6 +445,27 @@ TEST_F(BridgingTest, promiseTest) {
   EXPECT_NO_THROW(promise.reject("ignored"));
 }
 
+TEST_F(BridgingTest, promiseChurnTest) {
+  auto func = function(
+      "(promise, obj) => {"
+      "  promise.then((res) => { obj.sum += res; })"
+      "}");
+  auto output = jsi::Object(rt);
+  output.setProperty(rt, "sum", 0);
+
+  for (int i = 0; i < 10000; i++) {
+    auto promise = AsyncPromise<int>(rt, invoker);
+    func.call(rt, bridging::toJs(rt, promise, invoker), output);
+    promise.resolve(1);
+  }
+
+  // Settled promises are released as soon as their callbacks ran.
+  flushQueue();
+
+  EXPECT_EQ(10000, output.getProperty(rt, "sum").asNumber());
+  EXPECT_EQ(0, LongLivedObjectCollection::get(rt).size());
+}
+
 TEST_F(BridgingTest, optionalTest) {
   EXPECT_EQ(
       1, bridging::fromJs<std::optional<int>>(rt, jsi::Value(1), invoker));
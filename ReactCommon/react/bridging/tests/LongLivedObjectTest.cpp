@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <react/bridging/LongLivedObject.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+class TestObject : public LongLivedObject {
+ public:
+  TestObject() = default;
+};
+
+} // namespace
+
+TEST(LongLivedObjectTest, removesObjectsInAnyOrder) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  auto objects = std::vector<std::weak_ptr<TestObject>>{};
+
+  for (int i = 0; i < 100; i++) {
+    auto object = std::make_shared<TestObject>();
+    collection->add(object);
+    objects.push_back(object);
+  }
+
+  EXPECT_EQ(100, collection->size());
+
+  for (size_t i = 0; i < objects.size(); i += 2) {
+    objects[i].lock()->allowRelease();
+  }
+
+  EXPECT_EQ(50, collection->size());
+  for (size_t i = 0; i < objects.size(); i++) {
+    EXPECT_EQ(i % 2 == 0, objects[i].expired());
+  }
+
+  // The remaining objects in reverse order.
+  for (size_t i = 1; i < objects.size(); i += 2) {
+    collection->remove(objects[objects.size() - i].lock().get());
+  }
+
+  EXPECT_EQ(0, collection->size());
+}
+
+TEST(LongLivedObjectTest, addsObjectOnce) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  auto object = std::make_shared<TestObject>();
+
+  collection->add(object);
+  collection->add(object);
+  EXPECT_EQ(1, collection->size());
+
+  object->allowRelease();
+  EXPECT_EQ(0, collection->size());
+
+  // Releasing an object which is not in the collection has no effect.
+  object->allowRelease();
+  collection->remove(object.get());
+  EXPECT_EQ(0, collection->size());
+}
+
+TEST(LongLivedObjectTest, survivesConcurrentChurn) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  auto const numberOfThreads = 8;
+  auto const numberOfObjectsPerThread = 20000;
+
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < numberOfThreads; i++) {
+    threads.emplace_back([collection]() {
+      for (int j = 0; j < numberOfObjectsPerThread; j++) {
+        auto object = std::make_shared<TestObject>();
+        collection->add(object);
+
+        // Every hundredth object stays in the collection.
+        if (j % 100 == 0) {
+          continue;
+        }
+
+        if (j % 2 == 0) {
+          object->allowRelease();
+        } else {
+          collection->remove(object.get());
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(
+      numberOfThreads * numberOfObjectsPerThread / 100, collection->size());
+
+  collection->clear();
+  EXPECT_EQ(0, collection->size());
+}
+
+TEST(LongLivedObjectTest, keepsCollectionsOfRuntimesApart) {
+  auto runtimeA = hermes::makeHermesRuntime();
+  auto runtimeB = hermes::makeHermesRuntime();
+
+  auto objectA = std::make_shared<TestObject>();
+  auto objectB = std::make_shared<TestObject>();
+  LongLivedObjectCollection::get(*runtimeA).add(objectA);
+  LongLivedObjectCollection::get(*runtimeB).add(objectB);
+
+  auto weakObjectA = std::weak_ptr<TestObject>{objectA};
+  auto weakObjectB = std::weak_ptr<TestObject>{objectB};
+  objectA.reset();
+  objectB.reset();
+
+  LongLivedObjectCollection::discard(*runtimeA);
+
+  EXPECT_TRUE(weakObjectA.expired());
+  EXPECT_FALSE(weakObjectB.expired());
+  EXPECT_EQ(1, LongLivedObjectCollection::get(*runtimeB).size());
+
+  weakObjectB.lock()->allowRelease();
+  EXPECT_TRUE(weakObjectB.expired());
+
+  LongLivedObjectCollection::discard(*runtimeB);
+}
+
+} // namespace facebook::react
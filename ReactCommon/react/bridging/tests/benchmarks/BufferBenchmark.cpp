@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/bridging/Bridging.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+size_t const kPayloadSize = 1024 * 1024;
+
+jsi::Value eval(jsi::Runtime &rt, std::string const &js) {
+  return rt.global().getPropertyAsFunction(rt, "eval").call(rt, js);
+}
+
+std::string payloadSize() {
+  return std::to_string(kPayloadSize);
+}
+
+} // namespace
+
+/*
+ * A 1MB payload passed as an array of numbers, converted element by element.
+ */
+static void payloadFromJsViaArray(benchmark::State &state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto &rt = *runtime;
+  auto payload = eval(rt, "new Array(" + payloadSize() + ").fill(42)");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        bridging::fromJs<std::vector<int32_t>>(rt, payload, nullptr));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK(payloadFromJsViaArray)->Unit(benchmark::kMicrosecond);
+
+/*
+ * A 1MB payload passed as a `Uint8Array` and viewed without copying.
+ */
+static void payloadFromJsViaBufferView(benchmark::State &state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto &rt = *runtime;
+  auto payload = eval(rt, "new Uint8Array(" + payloadSize() + ").fill(42)");
+
+  for (auto _ : state) {
+    auto view = bridging::fromJs<BufferView<uint8_t>>(rt, payload, nullptr);
+    benchmark::DoNotOptimize(view.data());
+  }
+
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK(payloadFromJsViaBufferView)->Unit(benchmark::kMicrosecond);
+
+/*
+ * A native 1MB payload returned to JavaScript as an array of numbers.
+ */
+static void payloadToJsViaArray(benchmark::State &state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto &rt = *runtime;
+  auto bytes = std::vector<int32_t>(kPayloadSize, 42);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bridging::toJs(rt, bytes, nullptr));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK(payloadToJsViaArray)->Unit(benchmark::kMicrosecond);
+
+/*
+ * A native 1MB payload moved into an `ArrayBuffer`.
+ */
+static void payloadToJsViaVectorBuffer(benchmark::State &state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto &rt = *runtime;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto buffer = std::make_shared<VectorBuffer>(
+        std::vector<uint8_t>(kPayloadSize, 42));
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(bridging::toJs(rt, buffer, nullptr));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK(payloadToJsViaVectorBuffer)->Unit(benchmark::kMicrosecond);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -67,9 +67,12 @@ TurboCxxModule::TurboCxxModule(
 jsi::Value TurboCxxModule::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &propName) {
-  std::string propNameUtf8 = propName.utf8(runtime);
+  auto result = getCachedMethod(runtime, propName);
+  if (!result.isUndefined()) {
+    return result;
+  }
 
-  auto result = jsi::Value::undefined();
+  std::string propNameUtf8 = propName.utf8(runtime);
 
   if (propNameUtf8 == "getConstants") {
     // This is special cased because `getConstants()` is already a part of
@@ -109,11 +112,7 @@ jsi::Value TurboCxxModule::get(
     }
   }
 
-  // If we have a JS wrapper, cache the result of this lookup
-  if (jsRepresentation_) {
-    jsRepresentation_->setProperty(runtime, propName, result);
-  }
-
+  cacheMethod(runtime, propName, result);
   return result;
 }
 
@@ -19,7 +19,7 @@ jsi::Value TurboModule::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &propName,
     const MethodMetadata &meta) {
-  auto result = jsi::Function::createFromHostFunction(
+  jsi::Value result = jsi::Function::createFromHostFunction(
       runtime,
       propName,
       static_cast<unsigned int>(meta.argCount),
@@ -28,12 +28,55 @@ jsi::Value TurboModule::get(
           const jsi::Value &thisVal,
           const jsi::Value *args,
           size_t count) { return meta.invoker(rt, *this, args, count); });
-  // If we have a JS wrapper, cache the result of this lookup
   // We don't cache misses, to allow for methodMap_ to dynamically be extended
+  cacheMethod(runtime, propName, result);
+  return result;
+}
+
+jsi::Value TurboModule::getCachedMethod(
+    jsi::Runtime &runtime,
+    const jsi::PropNameID &propName) {
+  if (!methodCache_ || methodCacheRuntime_ != &runtime) {
+    return jsi::Value::undefined();
+  }
+  return methodCache_->getProperty(runtime, propName);
+}
+
+void TurboModule::cacheMethod(
+    jsi::Runtime &runtime,
+    const jsi::PropNameID &propName,
+    const jsi::Value &method) {
+  if (method.isUndefined()) {
+    return;
+  }
+
+  // If we have a JS wrapper, cache the result of this lookup there
   if (jsRepresentation_) {
-    jsRepresentation_->setProperty(runtime, propName, result);
+    jsRepresentation_->setProperty(runtime, propName, method);
+    return;
+  }
+
+  // Nothing would release the cache before the runtime goes away.
+  if (methodCacheRuntime_ != &runtime) {
+    return;
+  }
+
+  if (!methodCache_) {
+    methodCache_ = std::make_unique<jsi::Object>(runtime);
+    // Without a prototype, so properties of `Object.prototype` (e.g.
+    // `toString`) are never mistaken for cached methods.
+    methodCache_->setProperty(runtime, "__proto__", jsi::Value::null());
+  }
+
+  methodCache_->setProperty(runtime, propName, method);
+}
+
+void TurboModule::releaseJSValues(jsi::Runtime &runtime) {
+  jsRepresentation_.reset();
+  if (methodCacheRuntime_ == &runtime) {
+    methodCache_.reset();
+    methodCacheRuntime_ = nullptr;
   }
-  return result;
 }
 
 } // namespace react
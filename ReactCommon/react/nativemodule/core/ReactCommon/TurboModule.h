@@ -48,6 +48,11 @@ class JSI_EXPORT TurboModule : public facebook::jsi::HostObject {
       facebook::jsi::Runtime &runtime,
       const facebook::jsi::PropNameID &propName) override {
     {
+      auto cachedMethod = getCachedMethod(runtime, propName);
+      if (!cachedMethod.isUndefined()) {
+        return cachedMethod;
+      }
+
       std::string propNameUtf8 = propName.utf8(runtime);
       auto p = methodMap_.find(propNameUtf8);
       if (p == methodMap_.end()) {
@@ -88,10 +93,43 @@ class JSI_EXPORT TurboModule : public facebook::jsi::HostObject {
   friend class TurboModuleBinding;
   std::unique_ptr<jsi::Object> jsRepresentation_;
 
+  /*
+   * Host functions created so far (when there is no `jsRepresentation_` to
+   * cache them on), keyed by property name. Lets repeated property accesses
+   * skip the UTF-8 conversion, the `methodMap_` lookup and the creation of a
+   * new host function.
+   *
+   * Only modules handed out by a `TurboModuleBinding` have a cache, which
+   * belongs to the runtime of that binding (`methodCacheRuntime_`): the
+   * binding releases it before the runtime goes away, even if the module
+   * itself outlives the runtime.
+   */
+  std::unique_ptr<jsi::Object> methodCache_;
+  jsi::Runtime *methodCacheRuntime_{nullptr};
+
   facebook::jsi::Value get(
       facebook::jsi::Runtime &runtime,
       const facebook::jsi::PropNameID &propName,
       const MethodMetadata &meta);
+
+  /*
+   * Returns a host function previously created for `propName` in `runtime`,
+   * or `undefined`.
+   */
+  facebook::jsi::Value getCachedMethod(
+      facebook::jsi::Runtime &runtime,
+      const facebook::jsi::PropNameID &propName);
+
+  void cacheMethod(
+      facebook::jsi::Runtime &runtime,
+      const facebook::jsi::PropNameID &propName,
+      const facebook::jsi::Value &method);
+
+  /*
+   * Releases all JavaScript values the module retains in `runtime`. Must be
+   * called before the runtime is destroyed.
+   */
+  void releaseJSValues(facebook::jsi::Runtime &runtime);
 };
 
 /**
@@ -7,6 +7,7 @@
 
 #include "TurboModuleBinding.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 
@@ -25,8 +26,10 @@ namespace react {
 TurboModuleBinding::TurboModuleBinding(
     const TurboModuleProviderFunctionType &&moduleProvider,
     TurboModuleBindingMode bindingMode,
-    std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection)
-    : moduleProvider_(std::move(moduleProvider)),
+    std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection,
+    jsi::Runtime &runtime)
+    : runtime_(runtime),
+      moduleProvider_(std::move(moduleProvider)),
       longLivedObjectCollection_(std::move(longLivedObjectCollection)),
       bindingMode_(bindingMode) {}
 
@@ -42,23 +45,55 @@ void TurboModuleBinding::install(
           runtime,
           jsi::PropNameID::forAscii(runtime, "__turboModuleProxy"),
           1,
-          [binding = TurboModuleBinding(
+          // Shared, so that copies of the host function do not release the
+          // long-lived objects of the runtime prematurely.
+          [binding = std::shared_ptr<TurboModuleBinding>(new TurboModuleBinding(
                std::move(moduleProvider),
                bindingMode,
-               std::move(longLivedObjectCollection))](
+               std::move(longLivedObjectCollection),
+               runtime))](
               jsi::Runtime &rt,
               const jsi::Value &thisVal,
               const jsi::Value *args,
-              size_t count) mutable {
-            return binding.getModule(rt, thisVal, args, count);
+              size_t count) {
+            return binding->getModule(rt, thisVal, args, count);
           }));
 }
 
 TurboModuleBinding::~TurboModuleBinding() {
+  for (auto const &pair : modules_) {
+    if (auto module = pair.second.lock()) {
+      module->releaseJSValues(runtime_);
+    }
+  }
+
+  // Objects may be registered with the runtime's collection even when an
+  // explicit collection was provided (e.g. by `CallbackWrapper`).
   if (longLivedObjectCollection_) {
     longLivedObjectCollection_->clear();
-  } else {
-    LongLivedObjectCollection::get().clear();
+  }
+  LongLivedObjectCollection::discard(runtime_);
+}
+
+void TurboModuleBinding::rememberModule(
+    std::shared_ptr<TurboModule> const &module) {
+  if (!module->methodCacheRuntime_) {
+    module->methodCacheRuntime_ = &runtime_;
+  }
+
+  // Overwrites the entry of a destroyed module which had the same address.
+  modules_[module.get()] = module;
+
+  if (modules_.size() >= modulesSweepThreshold_) {
+    for (auto it = modules_.begin(); it != modules_.end();) {
+      if (it->second.expired()) {
+        it = modules_.erase(it);
+      } else {
+        it++;
+      }
+    }
+    modulesSweepThreshold_ =
+        std::max(modulesSweepThreshold_, modules_.size() * 2);
   }
 }
 
@@ -80,6 +115,8 @@ jsi::Value TurboModuleBinding::getModule(
     module = moduleProvider_(moduleName);
   }
   if (module) {
+    rememberModule(module);
+
     // Default behaviour
     if (bindingMode_ == TurboModuleBindingMode::HostObject) {
       return jsi::Object::createFromHostObject(runtime, std::move(module));
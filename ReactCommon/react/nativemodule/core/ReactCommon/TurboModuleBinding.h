@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 #include <ReactCommon/LongLivedObject.h>
 #include <ReactCommon/TurboModule.h>
@@ -39,12 +40,14 @@ class TurboModuleBinding {
       TurboModuleBindingMode bindingMode,
       std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection);
 
+  virtual ~TurboModuleBinding();
+
  private:
   TurboModuleBinding(
       const TurboModuleProviderFunctionType &&moduleProvider,
       TurboModuleBindingMode bindingMode,
-      std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection);
-  virtual ~TurboModuleBinding();
+      std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection,
+      jsi::Runtime &runtime);
 
   /**
    * A lookup function exposed to JS to get an instance of a TurboModule
@@ -56,9 +59,21 @@ class TurboModuleBinding {
       const jsi::Value *args,
       size_t count);
 
+  jsi::Runtime &runtime_;
   TurboModuleProviderFunctionType moduleProvider_;
   std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection_;
   TurboModuleBindingMode bindingMode_;
+
+  /*
+   * Modules returned to JavaScript so far. They retain JavaScript values
+   * (cached host functions), which are released when the binding (and
+   * therefore the runtime) goes away. Entries of destroyed modules are
+   * removed once the map grows past `modulesSweepThreshold_`.
+   */
+  std::unordered_map<TurboModule *, std::weak_ptr<TurboModule>> modules_;
+  size_t modulesSweepThreshold_{64};
+
+  void rememberModule(std::shared_ptr<TurboModule> const &module);
 };
 
 } // namespace react
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/instrumentation.h>
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+class TestTurboModule : public TurboModule {
+ public:
+  TestTurboModule() : TurboModule("TestTurboModule", nullptr) {
+    methodMap_["getNumber"] = MethodMetadata{0, getNumber};
+  }
+
+ private:
+  static jsi::Value getNumber(
+      jsi::Runtime &rt,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return jsi::Value(42);
+  }
+};
+
+/*
+ * Counts the allocations which are alive. Storage of a module created by
+ * `std::allocate_shared` stays allocated while a `std::weak_ptr` to it
+ * exists.
+ */
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  explicit CountingAllocator(int &liveAllocations)
+      : liveAllocations(liveAllocations) {}
+
+  template <typename U>
+  CountingAllocator(CountingAllocator<U> const &other)
+      : liveAllocations(other.liveAllocations) {}
+
+  T *allocate(size_t n) {
+    liveAllocations++;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T *pointer, size_t n) {
+    liveAllocations--;
+    std::allocator<T>{}.deallocate(pointer, n);
+  }
+
+  template <typename U>
+  bool operator==(CountingAllocator<U> const &other) const {
+    return &liveAllocations == &other.liveAllocations;
+  }
+
+  template <typename U>
+  bool operator!=(CountingAllocator<U> const &other) const {
+    return !(*this == other);
+  }
+
+  int &liveAllocations;
+};
+
+} // namespace
+
+class TurboModuleTest : public testing::Test {
+ protected:
+  void install(TurboModuleProviderFunctionType moduleProvider) {
+    TurboModuleBinding::install(
+        *runtime_,
+        std::move(moduleProvider),
+        TurboModuleBindingMode::HostObject,
+        nullptr);
+  }
+
+  jsi::Object getModule(std::string const &name) {
+    return runtime_->global()
+        .getPropertyAsFunction(*runtime_, "__turboModuleProxy")
+        .call(*runtime_, name)
+        .asObject(*runtime_);
+  }
+
+  bool isSameMethodReturnedTwice(jsi::Object const &object) {
+    auto first = object.getProperty(*runtime_, "getNumber");
+    auto second = object.getProperty(*runtime_, "getNumber");
+    EXPECT_EQ(
+        first.asObject(*runtime_)
+            .asFunction(*runtime_)
+            .call(*runtime_)
+            .getNumber(),
+        42);
+    return jsi::Value::strictEquals(*runtime_, first, second);
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_{
+      facebook::hermes::makeHermesRuntime()};
+};
+
+TEST_F(TurboModuleTest, cachesMethodsOfModulesReturnedByBinding) {
+  auto module = std::make_shared<TestTurboModule>();
+  install([&](std::string const &name) { return module; });
+
+  auto object = getModule("TestTurboModule");
+  EXPECT_TRUE(isSameMethodReturnedTwice(object));
+
+  // The cache has no prototype, so it does not turn properties of
+  // `Object.prototype` into methods of the module.
+  EXPECT_TRUE(object.getProperty(*runtime_, "toString").isUndefined());
+  EXPECT_TRUE(object.getProperty(*runtime_, "missing").isUndefined());
+}
+
+TEST_F(TurboModuleTest, doesNotCacheMethodsWithoutBinding) {
+  auto module = std::make_shared<TestTurboModule>();
+  auto object = jsi::Object::createFromHostObject(*runtime_, module);
+
+  // Nothing would release a cache before the runtime goes away.
+  EXPECT_FALSE(isSameMethodReturnedTwice(object));
+}
+
+TEST_F(TurboModuleTest, releasesCachedMethodsWhenRuntimeIsDestroyed) {
+  auto module = std::make_shared<TestTurboModule>();
+  auto moduleProvider = [&](std::string const &name) { return module; };
+
+  install(moduleProvider);
+  EXPECT_TRUE(isSameMethodReturnedTwice(getModule("TestTurboModule")));
+
+  // The module outlives the runtime. Its cache must be released together with
+  // the runtime, so a binding of the next runtime can cache methods again.
+  runtime_ = facebook::hermes::makeHermesRuntime();
+
+  install(moduleProvider);
+  EXPECT_TRUE(isSameMethodReturnedTwice(getModule("TestTurboModule")));
+}
+
+TEST_F(TurboModuleTest, forgetsDestroyedModules) {
+  auto liveAllocations = 0;
+  install([&](std::string const &name) {
+    return std::allocate_shared<TestTurboModule>(
+        CountingAllocator<TestTurboModule>{liveAllocations});
+  });
+
+  for (auto i = 0; i < 256; i++) {
+    getModule("TestTurboModule");
+    runtime_->instrumentation().collectGarbage("test");
+  }
+
+  // The binding only keeps weak references to the modules, and drops the
+  // ones of destroyed modules once it has remembered a few of them.
+  EXPECT_GT(liveAllocations, 0);
+  EXPECT_LE(liveAllocations, 64);
+
+  // The binding deallocates the remaining ones through `liveAllocations`.
+  runtime_.reset();
+  EXPECT_EQ(liveAllocations, 0);
+}
+
+} // namespace react
+} // namespace facebook
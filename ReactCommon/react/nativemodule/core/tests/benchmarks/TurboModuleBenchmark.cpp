@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+int const kNumberOfMethods = 64;
+
+jsi::Value returnUndefined(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t count) {
+  return jsi::Value::undefined();
+}
+
+/*
+ * Mirrors a codegen-generated spec with `kNumberOfMethods` methods.
+ */
+class BenchmarkTurboModule : public TurboModule {
+ public:
+  BenchmarkTurboModule() : TurboModule("BenchmarkTurboModule", nullptr) {
+    for (int i = 0; i < kNumberOfMethods; i++) {
+      methodMap_["method" + std::to_string(i)] =
+          MethodMetadata{0, returnUndefined};
+    }
+  }
+};
+
+std::vector<jsi::PropNameID> methodNames(jsi::Runtime &runtime) {
+  auto names = std::vector<jsi::PropNameID>{};
+  for (int i = 0; i < kNumberOfMethods; i++) {
+    names.push_back(
+        jsi::PropNameID::forUtf8(runtime, "method" + std::to_string(i)));
+  }
+  return names;
+}
+
+/*
+ * Installs the binding in HostObject mode, providing a new module on every
+ * lookup, like `global.__turboModuleProxy` does for the app.
+ */
+void installBinding(jsi::Runtime &runtime) {
+  TurboModuleBinding::install(
+      runtime,
+      [](std::string const &name) -> std::shared_ptr<TurboModule> {
+        return std::make_shared<BenchmarkTurboModule>();
+      },
+      TurboModuleBindingMode::HostObject,
+      nullptr);
+}
+
+jsi::Object requireModule(jsi::Runtime &runtime) {
+  return runtime.global()
+      .getPropertyAsFunction(runtime, "__turboModuleProxy")
+      .call(runtime, "BenchmarkTurboModule")
+      .getObject(runtime);
+}
+
+} // namespace
+
+/*
+ * Time per first access of a method of a freshly created module (includes
+ * the creation of the host function).
+ */
+static void turboModuleFirstMethodAccess(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  installBinding(*runtime);
+  auto names = methodNames(*runtime);
+
+  for (auto _ : state) {
+    auto module = requireModule(*runtime);
+    for (auto const &name : names) {
+      benchmark::DoNotOptimize(module.getProperty(*runtime, name));
+    }
+  }
+
+  state.counters["time/access"] = benchmark::Counter(
+      kNumberOfMethods,
+      benchmark::Counter::kIsIterationInvariantRate |
+          benchmark::Counter::kInvert);
+}
+BENCHMARK(turboModuleFirstMethodAccess);
+
+/*
+ * Time per call of a method of a module which was already accessed before
+ * (`module.methodN()` from JavaScript).
+ */
+static void turboModuleRepeatedMethodCall(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  installBinding(*runtime);
+  auto names = methodNames(*runtime);
+  auto module = requireModule(*runtime);
+
+  for (auto _ : state) {
+    for (auto const &name : names) {
+      benchmark::DoNotOptimize(module.getProperty(*runtime, name)
+                                   .getObject(*runtime)
+                                   .getFunction(*runtime)
+                                   .call(*runtime));
+    }
+  }
+
+  state.counters["time/call"] = benchmark::Counter(
+      kNumberOfMethods,
+      benchmark::Counter::kIsIterationInvariantRate |
+          benchmark::Counter::kInvert);
+}
+BENCHMARK(turboModuleRepeatedMethodCall);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
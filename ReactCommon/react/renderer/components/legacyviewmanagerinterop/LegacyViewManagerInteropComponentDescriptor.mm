@@ -93,6 +93,8 @@ LegacyViewManagerInteropComponentDescriptor::LegacyViewManagerInteropComponentDe
     ComponentDescriptorParameters const &parameters)
     : ConcreteComponentDescriptor(parameters), _coordinator(constructCoordinator(contextContainer_, flavor_))
 {
+  // The props keep all the raw props as `otherProps`, not only the parsed values which interned props are keyed on.
+  propsInternPool_ = nullptr;
 }
 
 ComponentHandle LegacyViewManagerInteropComponentDescriptor::getComponentHandle() const
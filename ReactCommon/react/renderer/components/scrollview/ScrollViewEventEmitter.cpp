@@ -10,7 +10,7 @@
 namespace facebook {
 namespace react {
 
-static jsi::Value scrollViewMetricsPayload(
+jsi::Value scrollViewMetricsPayload(
     jsi::Runtime &runtime,
     const ScrollViewMetrics &scrollViewMetrics) {
   auto payload = jsi::Object(runtime);
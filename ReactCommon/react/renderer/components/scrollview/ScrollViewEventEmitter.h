@@ -26,6 +26,14 @@ class ScrollViewMetrics {
   Float zoomScale;
 };
 
+/*
+ * Builds a payload of scroll events directly as a `jsi::Object` (without
+ * an intermediate `folly::dynamic`).
+ */
+jsi::Value scrollViewMetricsPayload(
+    jsi::Runtime &runtime,
+    ScrollViewMetrics const &scrollViewMetrics);
+
 class ScrollViewEventEmitter : public ViewEventEmitter {
  public:
   using ViewEventEmitter::ViewEventEmitter;
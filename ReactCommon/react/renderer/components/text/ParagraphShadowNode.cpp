@@ -33,6 +33,13 @@ Content const &ParagraphShadowNode::getContent(
 
   ensureUnsealed();
 
+  content_ = buildContent(layoutContext);
+
+  return content_.value();
+}
+
+Content ParagraphShadowNode::buildContent(
+    LayoutContext const &layoutContext) const {
   auto textAttributes = TextAttributes::defaultTextAttributes();
   textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
   textAttributes.apply(getConcreteProps().textAttributes);
@@ -44,10 +51,8 @@ Content const &ParagraphShadowNode::getContent(
   auto attachments = Attachments{};
   buildAttributedString(textAttributes, *this, attributedString, attachments);
 
-  content_ = Content{
+  return Content{
       attributedString, getConcreteProps().paragraphAttributes, attachments};
-
-  return content_.value();
 }
 
 Content ParagraphShadowNode::getContentWithMeasuredAttachments(
@@ -123,6 +128,42 @@ Size ParagraphShadowNode::measureContent(
   auto content =
       getContentWithMeasuredAttachments(layoutContext, layoutConstraints);
 
+  return textLayoutManager_
+      ->measure(
+          AttributedStringBox{
+              getMeasurableAttributedString(content, layoutContext)},
+          content.paragraphAttributes,
+          layoutConstraints)
+      .size;
+}
+
+void ParagraphShadowNode::premeasureContent(
+    LayoutContext const &layoutContext,
+    LayoutConstraints const &layoutConstraints) const {
+  if (!textLayoutManager_) {
+    return;
+  }
+
+  // Not using (and not populating) `content_` because the node must not be
+  // mutated here.
+  auto content = buildContent(layoutContext);
+
+  if (!content.attachments.empty()) {
+    // Measuring attachments requires laying them out, which is left to the
+    // layout pass.
+    return;
+  }
+
+  textLayoutManager_->measure(
+      AttributedStringBox{
+          getMeasurableAttributedString(content, layoutContext)},
+      content.paragraphAttributes,
+      layoutConstraints);
+}
+
+AttributedString ParagraphShadowNode::getMeasurableAttributedString(
+    Content const &content,
+    LayoutContext const &layoutContext) const {
   auto attributedString = content.attributedString;
   if (attributedString.isEmpty()) {
     // Note: `zero-width space` is insufficient in some cases (e.g. when we need
@@ -135,13 +176,7 @@ Size ParagraphShadowNode::measureContent(
     textAttributes.apply(getConcreteProps().textAttributes);
     attributedString.appendFragment({string, textAttributes, {}});
   }
-
-  return textLayoutManager_
-      ->measure(
-          AttributedStringBox{attributedString},
-          content.paragraphAttributes,
-          layoutConstraints)
-      .size;
+  return attributedString;
 }
 
 void ParagraphShadowNode::layout(LayoutContext layoutContext) {
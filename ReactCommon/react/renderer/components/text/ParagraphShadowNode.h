@@ -66,6 +66,9 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
   Size measureContent(
       LayoutContext const &layoutContext,
       LayoutConstraints const &layoutConstraints) const override;
+  void premeasureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const override;
 
   /*
    * Internal representation of the nested content of the node in a format
@@ -84,6 +87,19 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
    */
   Content const &getContent(LayoutContext const &layoutContext) const;
 
+  /*
+   * Builds a `Content` object (without caching it).
+   */
+  Content buildContent(LayoutContext const &layoutContext) const;
+
+  /*
+   * Returns the attributed string of `content` to be measured (which is
+   * a placeholder in case of empty content).
+   */
+  AttributedString getMeasurableAttributedString(
+      Content const &content,
+      LayoutContext const &layoutContext) const;
+
   /*
    * Builds and returns a `Content` object with given `layoutConstraints`.
    */
@@ -34,7 +34,8 @@ void ViewEventEmitter::onAccessibilityEscape() const {
 
 #pragma mark - Layout
 
-void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
+std::shared_ptr<ViewEventEmitter::LayoutEventState>
+ViewEventEmitter::prepareLayoutEvent(const LayoutMetrics &layoutMetrics) const {
   // A copy of a shared pointer (`layoutEventState_`) establishes shared
   // ownership that will be captured by lambda.
   auto layoutEventState = layoutEventState_;
@@ -61,7 +62,7 @@ void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
     // no other work is required.
     if (layoutEventState->frame == layoutMetrics.frame &&
         layoutEventState->wasDispatched) {
-      return;
+      return nullptr;
     }
 
     // If the *particular* `frame` was not already dispatched *or*
@@ -73,47 +74,99 @@ void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
     // Something is already in flight, dispatching another event is not
     // required.
     if (layoutEventState->isDispatching) {
-      return;
+      return nullptr;
     }
 
     layoutEventState->isDispatching = true;
   }
 
-  dispatchEvent(
-      "layout",
-      [layoutEventState](jsi::Runtime &runtime) {
-        auto frame = Rect{};
+  return layoutEventState;
+}
 
-        {
-          std::lock_guard<std::mutex> guard(layoutEventState->mutex);
+bool ViewEventEmitter::takeLayoutFrame(
+    LayoutEventState &layoutEventState,
+    Rect &frame) {
+  std::lock_guard<std::mutex> guard(layoutEventState.mutex);
 
-          layoutEventState->isDispatching = false;
+  layoutEventState.isDispatching = false;
 
-          // If some *particular* `frame` was already dispatched before,
-          // and since then there were no other new values of the `frame`
-          // observed, do nothing.
-          if (layoutEventState->wasDispatched) {
-            return jsi::Value::null();
-          }
+  // If some *particular* `frame` was already dispatched before,
+  // and since then there were no other new values of the `frame`
+  // observed, do nothing.
+  if (layoutEventState.wasDispatched) {
+    return false;
+  }
 
-          frame = layoutEventState->frame;
+  frame = layoutEventState.frame;
 
-          // If some *particular* `frame` was *not* already dispatched before,
-          // it's time to dispatch it and mark as dispatched.
-          layoutEventState->wasDispatched = true;
-        }
+  // If some *particular* `frame` was *not* already dispatched before,
+  // it's time to dispatch it and mark as dispatched.
+  layoutEventState.wasDispatched = true;
+  return true;
+}
+
+static ValueFactory layoutPayloadFactory(
+    std::function<bool(Rect &)> takeLayoutFrame) {
+  return [takeLayoutFrame](jsi::Runtime &runtime) {
+    auto frame = Rect{};
+    if (!takeLayoutFrame(frame)) {
+      return jsi::Value::null();
+    }
 
-        auto layout = jsi::Object(runtime);
-        layout.setProperty(runtime, "x", frame.origin.x);
-        layout.setProperty(runtime, "y", frame.origin.y);
-        layout.setProperty(runtime, "width", frame.size.width);
-        layout.setProperty(runtime, "height", frame.size.height);
-        auto payload = jsi::Object(runtime);
-        payload.setProperty(runtime, "layout", std::move(layout));
-        return jsi::Value(std::move(payload));
-      },
+    auto layout = jsi::Object(runtime);
+    layout.setProperty(runtime, "x", frame.origin.x);
+    layout.setProperty(runtime, "y", frame.origin.y);
+    layout.setProperty(runtime, "width", frame.size.width);
+    layout.setProperty(runtime, "height", frame.size.height);
+    auto payload = jsi::Object(runtime);
+    payload.setProperty(runtime, "layout", std::move(layout));
+    return jsi::Value(std::move(payload));
+  };
+}
+
+void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
+  auto layoutEventState = prepareLayoutEvent(layoutMetrics);
+  if (!layoutEventState) {
+    return;
+  }
+
+  dispatchEvent(
+      "layout",
+      layoutPayloadFactory([layoutEventState](Rect &frame) {
+        return takeLayoutFrame(*layoutEventState, frame);
+      }),
       EventPriority::AsynchronousUnbatched);
 }
 
+void ViewEventEmitter::onLayout(
+    const LayoutMetrics &layoutMetrics,
+    EventBatch &batch) const {
+  auto layoutEventState = prepareLayoutEvent(layoutMetrics);
+  if (!layoutEventState) {
+    return;
+  }
+
+  dispatchEvent(
+      batch,
+      "layout",
+      layoutPayloadFactory([layoutEventState](Rect &frame) {
+        return takeLayoutFrame(*layoutEventState, frame);
+      }),
+      [layoutEventState](std::vector<double> &buffer) {
+        auto frame = Rect{};
+        if (!takeLayoutFrame(*layoutEventState, frame)) {
+          return false;
+        }
+
+        buffer.insert(
+            buffer.end(),
+            {frame.origin.x,
+             frame.origin.y,
+             frame.size.width,
+             frame.size.height});
+        return true;
+      });
+}
+
 } // namespace react
 } // namespace facebook
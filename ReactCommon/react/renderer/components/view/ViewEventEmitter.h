@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 
+#include <react/renderer/core/EventBatch.h>
 #include <react/renderer/core/LayoutMetrics.h>
 #include <react/renderer/core/ReactPrimitives.h>
 
@@ -37,7 +38,31 @@ class ViewEventEmitter : public TouchEventEmitter {
 
   void onLayout(const LayoutMetrics &layoutMetrics) const;
 
+  /*
+   * Same as above, but appends the event to `batch` (which is supposed to
+   * collect layout events of all affected nodes of a commit) instead of
+   * dispatching it right away. The event has a packed payload: the `x`, `y`,
+   * `width` and `height` of the frame.
+   */
+  void onLayout(const LayoutMetrics &layoutMetrics, EventBatch &batch) const;
+
  private:
+  struct LayoutEventState;
+
+  /*
+   * Returns the layout event state which the payload of the layout event has
+   * to be taken from, or `nullptr` if dispatching is not needed (the same
+   * `frame` was already delivered or some event is already in flight).
+   */
+  std::shared_ptr<LayoutEventState> prepareLayoutEvent(
+      const LayoutMetrics &layoutMetrics) const;
+
+  /*
+   * Takes the `frame` which has to be delivered (on the JavaScript thread);
+   * returns `false` if it was already delivered.
+   */
+  static bool takeLayoutFrame(LayoutEventState &layoutEventState, Rect &frame);
+
   /*
    * Contains the most recent `frame` and a `mutex` protecting access to it.
    */
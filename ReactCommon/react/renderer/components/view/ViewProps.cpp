@@ -18,6 +18,54 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Returns whether `rawProps` contain any of the props which the cascaded
+ * corners or edges with the given `prefix` and `suffix` are converted from.
+ * Props which leave them as is share the block of the source props without
+ * converting and comparing the value.
+ */
+static bool hasCascadedCornersRawProps(
+    RawProps const &rawProps,
+    char const *prefix,
+    char const *suffix) {
+  auto hasValue = false;
+  for (auto name :
+       {"TopLeft",
+        "TopRight",
+        "BottomLeft",
+        "BottomRight",
+        "TopStart",
+        "TopEnd",
+        "BottomStart",
+        "BottomEnd",
+        ""}) {
+    // All names are looked up, in the order of the conversion, so that they
+    // are known to the parser.
+    hasValue = rawProps.at(name, prefix, suffix) != nullptr || hasValue;
+  }
+  return hasValue;
+}
+
+static bool hasCascadedEdgesRawProps(
+    RawProps const &rawProps,
+    char const *prefix,
+    char const *suffix) {
+  auto hasValue = false;
+  for (auto name :
+       {"Left",
+        "Right",
+        "Top",
+        "Bottom",
+        "Start",
+        "End",
+        "Horizontal",
+        "Vertical",
+        ""}) {
+    hasValue = rawProps.at(name, prefix, suffix) != nullptr || hasValue;
+  }
+  return hasValue;
+}
+
 ViewProps::ViewProps(
     const PropsParserContext &context,
     ViewProps const &sourceProps,
@@ -50,41 +98,57 @@ ViewProps::ViewProps(
                                                 sourceProps.backgroundColor,
                                                 {})),
       borderRadii(
-          Props::enablePropIteratorSetter ? sourceProps.borderRadii
-                                          : convertRawProp(
-                                                context,
-                                                rawProps,
-                                                "border",
-                                                "Radius",
-                                                sourceProps.borderRadii,
-                                                {})),
+          Props::enablePropIteratorSetter ||
+                  !hasCascadedCornersRawProps(rawProps, "border", "Radius")
+              ? sourceProps.borderRadii
+              : CopyOnWrite<CascadedBorderRadii>(
+                    convertRawProp(
+                        context,
+                        rawProps,
+                        "border",
+                        "Radius",
+                        sourceProps.borderRadii.get(),
+                        {}),
+                    sourceProps.borderRadii)),
       borderColors(
-          Props::enablePropIteratorSetter ? sourceProps.borderColors
-                                          : convertRawProp(
-                                                context,
-                                                rawProps,
-                                                "border",
-                                                "Color",
-                                                sourceProps.borderColors,
-                                                {})),
+          Props::enablePropIteratorSetter ||
+                  !hasCascadedEdgesRawProps(rawProps, "border", "Color")
+              ? sourceProps.borderColors
+              : CopyOnWrite<CascadedBorderColors>(
+                    convertRawProp(
+                        context,
+                        rawProps,
+                        "border",
+                        "Color",
+                        sourceProps.borderColors.get(),
+                        {}),
+                    sourceProps.borderColors)),
       borderCurves(
-          Props::enablePropIteratorSetter ? sourceProps.borderCurves
-                                          : convertRawProp(
-                                                context,
-                                                rawProps,
-                                                "border",
-                                                "Curve",
-                                                sourceProps.borderCurves,
-                                                {})),
+          Props::enablePropIteratorSetter ||
+                  !hasCascadedCornersRawProps(rawProps, "border", "Curve")
+              ? sourceProps.borderCurves
+              : CopyOnWrite<CascadedBorderCurves>(
+                    convertRawProp(
+                        context,
+                        rawProps,
+                        "border",
+                        "Curve",
+                        sourceProps.borderCurves.get(),
+                        {}),
+                    sourceProps.borderCurves)),
       borderStyles(
-          Props::enablePropIteratorSetter ? sourceProps.borderStyles
-                                          : convertRawProp(
-                                                context,
-                                                rawProps,
-                                                "border",
-                                                "Style",
-                                                sourceProps.borderStyles,
-                                                {})),
+          Props::enablePropIteratorSetter ||
+                  !hasCascadedEdgesRawProps(rawProps, "border", "Style")
+              ? sourceProps.borderStyles
+              : CopyOnWrite<CascadedBorderStyles>(
+                    convertRawProp(
+                        context,
+                        rawProps,
+                        "border",
+                        "Style",
+                        sourceProps.borderStyles.get(),
+                        {}),
+                    sourceProps.borderStyles)),
       shadowColor(
           Props::enablePropIteratorSetter ? sourceProps.shadowColor
                                           : convertRawProp(
@@ -118,13 +182,17 @@ ViewProps::ViewProps(
                                                 sourceProps.shadowRadius,
                                                 {})),
       transform(
-          Props::enablePropIteratorSetter ? sourceProps.transform
-                                          : convertRawProp(
-                                                context,
-                                                rawProps,
-                                                "transform",
-                                                sourceProps.transform,
-                                                {})),
+          Props::enablePropIteratorSetter ||
+                  rawProps.at("transform", nullptr, nullptr) == nullptr
+              ? sourceProps.transform
+              : CopyOnWrite<Transform>(
+                    convertRawProp(
+                        context,
+                        rawProps,
+                        "transform",
+                        sourceProps.transform.get(),
+                        {}),
+                    sourceProps.transform)),
       backfaceVisibility(
           Props::enablePropIteratorSetter ? sourceProps.backfaceVisibility
                                           : convertRawProp(
@@ -288,7 +356,7 @@ void ViewProps::setProp(
     RAW_SET_PROP_SWITCH_CASE_BASIC(shadowOffset, {});
     RAW_SET_PROP_SWITCH_CASE_BASIC(shadowOpacity, {});
     RAW_SET_PROP_SWITCH_CASE_BASIC(shadowRadius, {});
-    RAW_SET_PROP_SWITCH_CASE_BASIC(transform, {});
+    RAW_SET_PROP_SWITCH_CASE(transform.edit(), "transform", {});
     RAW_SET_PROP_SWITCH_CASE_BASIC(backfaceVisibility, {});
     RAW_SET_PROP_SWITCH_CASE_BASIC(shouldRasterize, {});
     RAW_SET_PROP_SWITCH_CASE_BASIC(zIndex, {});
@@ -348,9 +416,10 @@ void ViewProps::setProp(
     RAW_SET_PROP_SWITCH_CASE_BASIC(renderToHardwareTextureAndroid, false);
 #endif
     // BorderRadii
-    SET_CASCADED_RECTANGLE_CORNERS(borderRadii, "border", "Radius", value);
-    SET_CASCADED_RECTANGLE_EDGES(borderColors, "border", "Color", value);
-    SET_CASCADED_RECTANGLE_EDGES(borderStyles, "border", "Style", value);
+    SET_CASCADED_RECTANGLE_CORNERS(
+        borderRadii.edit(), "border", "Radius", value);
+    SET_CASCADED_RECTANGLE_EDGES(borderColors.edit(), "border", "Color", value);
+    SET_CASCADED_RECTANGLE_EDGES(borderStyles.edit(), "border", "Style", value);
   }
 }
 
@@ -415,12 +484,13 @@ BorderMetrics ViewProps::resolveBorderMetrics(
   };
 
   return {
-      /* .borderColors = */ borderColors.resolve(isRTL, {}),
+      /* .borderColors = */ borderColors->resolve(isRTL, {}),
       /* .borderWidths = */ borderWidths.resolve(isRTL, 0),
       /* .borderRadii = */
-      ensureNoOverlap(borderRadii.resolve(isRTL, 0), layoutMetrics.frame.size),
-      /* .borderCurves = */ borderCurves.resolve(isRTL, BorderCurve::Circular),
-      /* .borderStyles = */ borderStyles.resolve(isRTL, BorderStyle::Solid),
+      ensureNoOverlap(
+          borderRadii->resolve(isRTL, 0), layoutMetrics.frame.size),
+      /* .borderCurves = */ borderCurves->resolve(isRTL, BorderCurve::Circular),
+      /* .borderStyles = */ borderStyles->resolve(isRTL, BorderStyle::Solid),
   };
 }
 
@@ -10,6 +10,7 @@
 #include <react/renderer/components/view/AccessibilityProps.h>
 #include <react/renderer/components/view/YogaStylableProps.h>
 #include <react/renderer/components/view/primitives.h>
+#include <react/renderer/core/CopyOnWrite.h>
 #include <react/renderer/core/LayoutMetrics.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
@@ -49,10 +50,11 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
   SharedColor backgroundColor{};
 
   // Borders
-  CascadedBorderRadii borderRadii{};
-  CascadedBorderColors borderColors{};
-  CascadedBorderCurves borderCurves{};
-  CascadedBorderStyles borderStyles{};
+  // Rarely set and large, so kept out of line and shared between clones.
+  CopyOnWrite<CascadedBorderRadii> borderRadii{};
+  CopyOnWrite<CascadedBorderColors> borderColors{};
+  CopyOnWrite<CascadedBorderCurves> borderCurves{};
+  CopyOnWrite<CascadedBorderStyles> borderStyles{};
 
   // Shadow
   SharedColor shadowColor{};
@@ -61,7 +63,7 @@ class ViewProps : public YogaStylableProps, public AccessibilityProps {
   Float shadowRadius{3};
 
   // Transform
-  Transform transform{};
+  CopyOnWrite<Transform> transform{};
   BackfaceVisibility backfaceVisibility{};
   bool shouldRasterize{};
   std::optional<int> zIndex{};
@@ -43,12 +43,15 @@ static inline void interpolateViewProps(
   // that use RawProps/folly::dynamic instead of concrete props on the
   // mounting layer. Once we can remove this, we should change `rawProps` to
   // be const again.
+  // Empty raw props (see `Props::hasRawProps`) are re-hydrated too, as they
+  // are all that the mounting layer gets; null ones aren't kept at all.
 #ifdef ANDROID
   if (!interpolatedProps->rawProps.isNull()) {
-    interpolatedProps->rawProps["opacity"] = interpolatedProps->opacity;
+    auto rawProps = interpolatedProps->getRawProps();
+    rawProps["opacity"] = interpolatedProps->opacity;
 
-    interpolatedProps->rawProps["transform"] =
-        (folly::dynamic)interpolatedProps->transform;
+    rawProps["transform"] = (folly::dynamic)*interpolatedProps->transform;
+    interpolatedProps->setRawProps(std::move(rawProps));
   }
 #endif
 }
@@ -9,30 +9,37 @@
 #include <react/config/ReactNativeConfig.h>
 #include <react/renderer/components/view/primitives.h>
 
+#include <atomic>
+
 namespace facebook {
 namespace react {
 
 char const ViewComponentName[] = "View";
 
 static inline bool keepRawValuesInViewProps(PropsParserContext const &context) {
-  static bool shouldUseRawProps = true;
-
 #ifdef ANDROID
-  static bool initialized = false;
+  // Read from the config once it is available. Props are parsed on several
+  // threads at the same time.
+  static std::atomic<int> shouldUseRawProps{-1};
 
-  if (!initialized) {
+  auto value = shouldUseRawProps.load(std::memory_order_relaxed);
+  if (value == -1) {
     auto config =
         context.contextContainer.find<std::shared_ptr<const ReactNativeConfig>>(
             "ReactNativeConfig");
-    if (config.has_value()) {
-      initialized = true;
-      shouldUseRawProps = !config.value()->getBool(
-          "react_native_new_architecture:use_mapbuffer_for_viewprops");
+    if (!config.has_value()) {
+      return true;
     }
+    value = config.value()->getBool(
+                "react_native_new_architecture:use_mapbuffer_for_viewprops")
+        ? 0
+        : 1;
+    shouldUseRawProps.store(value, std::memory_order_relaxed);
   }
+  return value == 1;
+#else
+  return true;
 #endif
-
-  return shouldUseRawProps;
 }
 
 ViewShadowNodeProps::ViewShadowNodeProps(
@@ -698,47 +698,62 @@ void YogaLayoutableShadowNode::swapLeftAndRightInYogaStyleProps(
 void YogaLayoutableShadowNode::swapLeftAndRightInViewProps(
     YogaLayoutableShadowNode const &shadowNode) {
   auto &typedCasting = static_cast<ViewProps const &>(*shadowNode.props_);
+  // The props are edited in place even though other nodes may share them:
+  // the previous revisions of this node, and with `PropsInternPool`, other
+  // nodes of the same surface cloned from the same props with the same raw
+  // props. Those are laid out with the same `LayoutContext` and would get
+  // the same values, and swapping values which were already swapped does
+  // nothing, so every node ends up with the props it would have had on its
+  // own.
   auto &props = const_cast<ViewProps &>(typedCasting);
 
   // Swap border node values, borderRadii, borderColors and borderStyles.
-  if (props.borderRadii.topLeft.has_value()) {
-    props.borderRadii.topStart = props.borderRadii.topLeft;
-    props.borderRadii.topLeft.reset();
+  if (props.borderRadii->topLeft.has_value()) {
+    auto &borderRadii = props.borderRadii.edit();
+    borderRadii.topStart = borderRadii.topLeft;
+    borderRadii.topLeft.reset();
   }
 
-  if (props.borderRadii.bottomLeft.has_value()) {
-    props.borderRadii.bottomStart = props.borderRadii.bottomLeft;
-    props.borderRadii.bottomLeft.reset();
+  if (props.borderRadii->bottomLeft.has_value()) {
+    auto &borderRadii = props.borderRadii.edit();
+    borderRadii.bottomStart = borderRadii.bottomLeft;
+    borderRadii.bottomLeft.reset();
   }
 
-  if (props.borderRadii.topRight.has_value()) {
-    props.borderRadii.topEnd = props.borderRadii.topRight;
-    props.borderRadii.topRight.reset();
+  if (props.borderRadii->topRight.has_value()) {
+    auto &borderRadii = props.borderRadii.edit();
+    borderRadii.topEnd = borderRadii.topRight;
+    borderRadii.topRight.reset();
   }
 
-  if (props.borderRadii.bottomRight.has_value()) {
-    props.borderRadii.bottomEnd = props.borderRadii.bottomRight;
-    props.borderRadii.bottomRight.reset();
+  if (props.borderRadii->bottomRight.has_value()) {
+    auto &borderRadii = props.borderRadii.edit();
+    borderRadii.bottomEnd = borderRadii.bottomRight;
+    borderRadii.bottomRight.reset();
   }
 
-  if (props.borderColors.left.has_value()) {
-    props.borderColors.start = props.borderColors.left;
-    props.borderColors.left.reset();
+  if (props.borderColors->left.has_value()) {
+    auto &borderColors = props.borderColors.edit();
+    borderColors.start = borderColors.left;
+    borderColors.left.reset();
   }
 
-  if (props.borderColors.right.has_value()) {
-    props.borderColors.end = props.borderColors.right;
-    props.borderColors.right.reset();
+  if (props.borderColors->right.has_value()) {
+    auto &borderColors = props.borderColors.edit();
+    borderColors.end = borderColors.right;
+    borderColors.right.reset();
   }
 
-  if (props.borderStyles.left.has_value()) {
-    props.borderStyles.start = props.borderStyles.left;
-    props.borderStyles.left.reset();
+  if (props.borderStyles->left.has_value()) {
+    auto &borderStyles = props.borderStyles.edit();
+    borderStyles.start = borderStyles.left;
+    borderStyles.left.reset();
   }
 
-  if (props.borderStyles.right.has_value()) {
-    props.borderStyles.end = props.borderStyles.right;
-    props.borderStyles.right.reset();
+  if (props.borderStyles->right.has_value()) {
+    auto &borderStyles = props.borderStyles.edit();
+    borderStyles.end = borderStyles.right;
+    borderStyles.right.reset();
   }
 
   YGStyle::Edges const &border = props.yogaStyle.border();
@@ -103,11 +103,11 @@ class LayoutTest : public ::testing::Test {
                     yogaStyle.dimensions()[YGDimensionHeight] = YGValue{90, YGUnitPoint};
 
                     if (testCase == TRANSFORM_SCALE) {
-                      props.transform = props.transform * Transform::Scale(2, 2, 1);
+                      props.transform = *props.transform * Transform::Scale(2, 2, 1);
                     }
 
                     if (testCase == TRANSFORM_TRANSLATE) {
-                      props.transform = props.transform * Transform::Translate(10, 10, 0);
+                      props.transform = *props.transform * Transform::Translate(10, 10, 0);
                     }
                     return sharedProps;
                   })
@@ -101,6 +101,8 @@ class ComponentDescriptor {
    * If `props` is `nullptr`, a default `Props` object (with default values)
    * will be used.
    * Must return an object which is NOT pointer equal to `props`.
+   * May return the same object for calls with equal arguments if props
+   * interning is enabled (see `PropsInternPool`).
    */
   virtual Props::Shared cloneProps(
       const PropsParserContext &context,
@@ -15,6 +15,7 @@
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsInternPool.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
@@ -50,6 +51,11 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   ConcreteComponentDescriptor(ComponentDescriptorParameters const &parameters)
       : ComponentDescriptor(parameters) {
     rawPropsParser_.prepare<ConcreteProps>();
+
+    if (contextContainer_ &&
+        contextContainer_->find<bool>("EnablePropsInterning").value_or(false)) {
+      propsInternPool_ = std::make_unique<PropsInternPool>();
+    }
   }
 
   ComponentHandle getComponentHandle() const override {
@@ -109,21 +115,13 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
     rawProps.parse(rawPropsParser_, context);
 
-    // Call old-style constructor
-    auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, props);
-
-    // Use the new-style iterator
-    // Note that we just check if `Props` has this flag set, no matter
-    // the type of ShadowNode; it acts as the single global flag.
-    if (Props::enablePropIteratorSetter) {
-      rawProps.iterateOverValues([&](RawPropsPropNameHash hash,
-                                     const char *propName,
-                                     RawValue const &fn) {
-        shadowNodeProps.get()->setProp(context, hash, propName, fn);
+    if (propsInternPool_) {
+      return propsInternPool_->intern(context, props, rawProps, [&]() {
+        return createProps(context, props, rawProps);
       });
     }
 
-    return shadowNodeProps;
+    return createProps(context, props, rawProps);
   };
 
   Props::Shared interpolateProps(
@@ -135,8 +133,9 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     // On Android only, the merged props should have the same RawProps as the
     // final props struct
     Props::Shared interpolatedPropsShared =
-        (newProps != nullptr ? cloneProps(context, newProps, newProps->rawProps)
-                             : cloneProps(context, newProps, {}));
+        (newProps != nullptr
+             ? cloneProps(context, newProps, newProps->getRawProps())
+             : cloneProps(context, newProps, {}));
 #else
     Props::Shared interpolatedPropsShared = cloneProps(context, newProps, {});
 #endif
@@ -210,6 +209,35 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     react_native_assert(
         shadowNode->getComponentHandle() == getComponentHandle());
   }
+
+  /*
+   * Shares identical props objects between the nodes of the component.
+   * Created for all components if `EnablePropsInterning` is set in the context
+   * container; a subclass may also create it for its component only.
+   */
+  std::unique_ptr<PropsInternPool> propsInternPool_;
+
+ private:
+  Props::Shared createProps(
+      const PropsParserContext &context,
+      const Props::Shared &props,
+      const RawProps &rawProps) const {
+    // Call old-style constructor
+    auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, props);
+
+    // Use the new-style iterator
+    // Note that we just check if `Props` has this flag set, no matter
+    // the type of ShadowNode; it acts as the single global flag.
+    if (Props::enablePropIteratorSetter) {
+      rawProps.iterateOverValues([&](RawPropsPropNameHash hash,
+                                     const char *propName,
+                                     RawValue const &fn) {
+        shadowNodeProps.get()->setProp(context, hash, propName, fn);
+      });
+    }
+
+    return shadowNodeProps;
+  }
 };
 
 } // namespace react
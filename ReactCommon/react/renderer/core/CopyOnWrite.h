@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Stores a value of type `T` out of line, in an immutable ref-counted block
+ * which copies share until one of them is mutated via `edit()`.
+ *
+ * Meant for large props fields that most components leave at their default
+ * values (e.g. `ViewProps::transform`): all default values share a single
+ * block, and cloned props objects share the blocks of the fields that the
+ * update did not change, so that neither takes more than a pointer in the
+ * props object.
+ *
+ * `T` must be default-constructible and equality-comparable. Like the props
+ * objects that hold it, a `CopyOnWrite` must not be mutated once it's shared
+ * with other threads.
+ */
+template <typename T>
+class CopyOnWrite final {
+ public:
+  CopyOnWrite() : value_(defaultValue()) {}
+
+  CopyOnWrite(T value) : value_(makeValue(std::move(value))) {}
+
+  /*
+   * Shares the block of `source` if `value` is equal to it, e.g. when `value`
+   * was parsed from raw props which don't contain the field.
+   */
+  CopyOnWrite(T value, CopyOnWrite const &source)
+      : value_(
+            value == *source.value_ ? source.value_
+                                    : makeValue(std::move(value))) {}
+
+  CopyOnWrite &operator=(T value) {
+    value_ = makeValue(std::move(value));
+    return *this;
+  }
+
+  T const &get() const noexcept {
+    return *value_;
+  }
+
+  operator T const &() const noexcept {
+    return *value_;
+  }
+
+  T const &operator*() const noexcept {
+    return *value_;
+  }
+
+  T const *operator->() const noexcept {
+    return value_.get();
+  }
+
+  /*
+   * Returns a mutable reference to the value, copying it first if the block
+   * is shared.
+   */
+  T &edit() {
+    if (value_.use_count() != 1) {
+      value_ = std::make_shared<T>(*value_);
+    }
+    return *value_;
+  }
+
+  friend bool operator==(CopyOnWrite const &lhs, CopyOnWrite const &rhs) {
+    return lhs.value_ == rhs.value_ || *lhs.value_ == *rhs.value_;
+  }
+
+  friend bool operator!=(CopyOnWrite const &lhs, CopyOnWrite const &rhs) {
+    return !(lhs == rhs);
+  }
+
+  friend bool operator==(CopyOnWrite const &lhs, T const &rhs) {
+    return *lhs.value_ == rhs;
+  }
+
+  friend bool operator!=(CopyOnWrite const &lhs, T const &rhs) {
+    return !(*lhs.value_ == rhs);
+  }
+
+  friend bool operator==(T const &lhs, CopyOnWrite const &rhs) {
+    return lhs == *rhs.value_;
+  }
+
+  friend bool operator!=(T const &lhs, CopyOnWrite const &rhs) {
+    return !(lhs == *rhs.value_);
+  }
+
+ private:
+  static std::shared_ptr<T> const &defaultValue() {
+    static auto const value = std::make_shared<T>();
+    return value;
+  }
+
+  static std::shared_ptr<T> makeValue(T &&value) {
+    if (value == *defaultValue()) {
+      return defaultValue();
+    }
+    return std::make_shared<T>(std::move(value));
+  }
+
+  std::shared_ptr<T> value_;
+};
+
+} // namespace react
+} // namespace facebook
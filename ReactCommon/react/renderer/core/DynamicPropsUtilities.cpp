@@ -7,8 +7,20 @@
 
 #include "DynamicPropsUtilities.h"
 
+#include <folly/json.h>
+
 namespace facebook {
 namespace react {
+
+static folly::json::serialization_opts const &serializationOptions() {
+  static auto const options = [] {
+    auto options = folly::json::serialization_opts{};
+    options.allow_nan_inf = true;
+    return options;
+  }();
+  return options;
+}
+
 folly::dynamic mergeDynamicProps(
     folly::dynamic const &source,
     folly::dynamic const &patch) {
@@ -31,5 +43,16 @@ folly::dynamic mergeDynamicProps(
   return result;
 }
 
+folly::dynamic serializeDynamicProps(folly::dynamic const &props) {
+  return folly::json::serialize(props, serializationOptions());
+}
+
+folly::dynamic deserializeDynamicProps(folly::dynamic const &props) {
+  if (!props.isString()) {
+    return props;
+  }
+  return folly::parseJson(props.getString(), serializationOptions());
+}
+
 } // namespace react
 } // namespace facebook
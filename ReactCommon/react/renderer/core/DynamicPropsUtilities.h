@@ -16,5 +16,17 @@ folly::dynamic mergeDynamicProps(
     folly::dynamic const &source,
     folly::dynamic const &patch);
 
+/*
+ * Serializes `props` (an object) as a JSON string, which takes a fraction of
+ * the memory of the object when it's kept around.
+ */
+folly::dynamic serializeDynamicProps(folly::dynamic const &props);
+
+/*
+ * Returns `props` as an object, parsing them if they were serialized by
+ * `serializeDynamicProps`.
+ */
+folly::dynamic deserializeDynamicProps(folly::dynamic const &props);
+
 } // namespace react
 } // namespace facebook
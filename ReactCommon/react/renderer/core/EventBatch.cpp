@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventBatch.h"
+
+#include <react/renderer/debug/SystraceSection.h>
+
+namespace facebook {
+namespace react {
+
+EventBatch::EventBatch(EventPriority priority) : priority_(priority) {}
+
+EventBatch::~EventBatch() {
+  dispatch();
+}
+
+void EventBatch::append(
+    EventDispatcher::Shared eventDispatcher,
+    RawEvent &&rawEvent) {
+  if (eventDispatcher_ != eventDispatcher) {
+    dispatch();
+    eventDispatcher_ = std::move(eventDispatcher);
+  }
+
+  rawEvents_.push_back(std::move(rawEvent));
+}
+
+void EventBatch::dispatch() {
+  if (rawEvents_.empty()) {
+    return;
+  }
+
+  SystraceSection s("EventBatch::dispatch", "size", rawEvents_.size());
+
+  auto rawEvents = std::move(rawEvents_);
+  rawEvents_.clear();
+
+  if (eventDispatcher_) {
+    eventDispatcher_->dispatchEvents(std::move(rawEvents), priority_);
+  }
+}
+
+size_t EventBatch::size() const {
+  return rawEvents_.size();
+}
+
+} // namespace react
+} // namespace facebook
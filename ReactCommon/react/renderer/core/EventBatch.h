@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/EventPriority.h>
+#include <react/renderer/core/RawEvent.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Accumulates events emitted by many event emitters (e.g. `onLayout` events
+ * of all nodes affected by a commit) and hands them over to the event queue
+ * at once: the queue is locked and the beat is requested once per batch.
+ * Events keep their own targets, so coalescing policies and event listeners
+ * apply to them as usual; events with packed payloads are delivered to
+ * JavaScript in a single call per run (see `PackedEventPipe`).
+ * Not thread-safe; is meant to be used as a local variable.
+ */
+class EventBatch {
+ public:
+  EventBatch(EventPriority priority);
+
+  EventBatch(EventBatch const &) = delete;
+  EventBatch &operator=(EventBatch const &) = delete;
+
+  /*
+   * Dispatches events which were not dispatched explicitly.
+   */
+  ~EventBatch();
+
+  /*
+   * Appends an event which has to be dispatched via `eventDispatcher`.
+   * Events addressed to a different dispatcher than the previous ones cause
+   * flushing of the accumulated events first (which preserves ordering).
+   */
+  void append(EventDispatcher::Shared eventDispatcher, RawEvent &&rawEvent);
+
+  /*
+   * Dispatches all accumulated events.
+   */
+  void dispatch();
+
+  /*
+   * Returns the number of accumulated events.
+   */
+  size_t size() const;
+
+ private:
+  EventPriority priority_;
+  EventDispatcher::Shared eventDispatcher_;
+  std::vector<RawEvent> rawEvents_;
+};
+
+} // namespace react
+} // namespace facebook
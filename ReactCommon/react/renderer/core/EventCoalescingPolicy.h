@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include <react/renderer/core/ValueFactory.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Describes how an `EventQueue` merges multiple pending events of the same
+ * type addressed to the same target.
+ * Unlike `EventQueue::enqueueUniqueEvent` (which only merges with the
+ * immediately preceding event of the same target), a policy applies per
+ * (target, type) pair regardless of how events of different targets or types
+ * are interleaved in the queue. As a result, JavaScript receives at most one
+ * payload per target per beat for every event type with a registered policy.
+ */
+struct EventCoalescingPolicy {
+  /*
+   * Merges the payload of a pending event with the payload of a newer one.
+   * Called under the queue lock; must be cheap and must not dispatch events.
+   */
+  using Accumulator = std::function<ValueFactory(
+      ValueFactory const &previousPayloadFactory,
+      ValueFactory const &nextPayloadFactory)>;
+
+  enum class Kind {
+    /*
+     * A newer event replaces the pending one; the merged event is delivered
+     * in the position of the newest one.
+     */
+    LatestWins,
+
+    /*
+     * Same as `LatestWins`, but additionally an event is delivered to a given
+     * target not more often than once per `samplingInterval`. An event which
+     * is too early stays in the queue until a following beat.
+     */
+    Sampled,
+
+    /*
+     * A newer event is merged with the pending one using `accumulator`.
+     */
+    Accumulate,
+  };
+
+  static EventCoalescingPolicy latestWins() {
+    return {Kind::LatestWins, {}, {}};
+  }
+
+  static EventCoalescingPolicy sampled(
+      std::chrono::steady_clock::duration samplingInterval) {
+    return {Kind::Sampled, samplingInterval, {}};
+  }
+
+  static EventCoalescingPolicy accumulate(Accumulator accumulator) {
+    return {Kind::Accumulate, {}, std::move(accumulator)};
+  }
+
+  Kind kind{Kind::LatestWins};
+  std::chrono::steady_clock::duration samplingInterval{};
+  Accumulator accumulator{};
+};
+
+} // namespace react
+} // namespace facebook
@@ -7,6 +7,8 @@
 
 #include "EventDispatcher.h"
 
+#include <algorithm>
+
 #include <react/renderer/core/StateUpdate.h>
 
 #include "BatchedEventQueue.h"
@@ -43,6 +45,26 @@ void EventDispatcher::dispatchEvent(RawEvent &&rawEvent, EventPriority priority)
   getEventQueue(priority).enqueueEvent(std::move(rawEvent));
 }
 
+void EventDispatcher::dispatchEvents(
+    std::vector<RawEvent> &&rawEvents,
+    EventPriority priority) const {
+  // Allows the event listener to interrupt default event dispatch
+  rawEvents.erase(
+      std::remove_if(
+          rawEvents.begin(),
+          rawEvents.end(),
+          [this](RawEvent const &rawEvent) {
+            return eventListeners_.willDispatchEvent(rawEvent);
+          }),
+      rawEvents.end());
+
+  if (rawEvents.empty()) {
+    return;
+  }
+
+  getEventQueue(priority).enqueueEvents(std::move(rawEvents));
+}
+
 void EventDispatcher::dispatchStateUpdate(
     StateUpdate &&stateUpdate,
     EventPriority priority) const {
@@ -57,6 +79,15 @@ void EventDispatcher::dispatchUniqueEvent(RawEvent &&rawEvent) const {
   asynchronousBatchedQueue_->enqueueUniqueEvent(std::move(rawEvent));
 }
 
+void EventDispatcher::setEventCoalescingPolicy(
+    std::string const &type,
+    EventCoalescingPolicy const &policy) const {
+  synchronousUnbatchedQueue_->setCoalescingPolicy(type, policy);
+  synchronousBatchedQueue_->setCoalescingPolicy(type, policy);
+  asynchronousUnbatchedQueue_->setCoalescingPolicy(type, policy);
+  asynchronousBatchedQueue_->setCoalescingPolicy(type, policy);
+}
+
 const EventQueue &EventDispatcher::getEventQueue(EventPriority priority) const {
   switch (priority) {
     case EventPriority::SynchronousUnbatched:
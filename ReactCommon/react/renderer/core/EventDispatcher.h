@@ -9,6 +9,7 @@
 
 #include <react/renderer/core/BatchedEventQueue.h>
 #include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventCoalescingPolicy.h>
 #include <react/renderer/core/EventListener.h>
 #include <react/renderer/core/EventPriority.h>
 #include <react/renderer/core/EventQueueProcessor.h>
@@ -40,6 +41,12 @@ class EventDispatcher {
    */
   void dispatchEvent(RawEvent &&rawEvent, EventPriority priority) const;
 
+  /*
+   * Dispatches a list of raw events with given priority at once.
+   */
+  void dispatchEvents(std::vector<RawEvent> &&rawEvents, EventPriority priority)
+      const;
+
   /*
    * Dispatches a raw event with asynchronous batched priority. Before the
    * dispatch we make sure that no other RawEvent of same type and same target
@@ -53,6 +60,15 @@ class EventDispatcher {
   void dispatchStateUpdate(StateUpdate &&stateUpdate, EventPriority priority)
       const;
 
+  /*
+   * Registers a coalescing policy for events of a given type across all event
+   * queues. The type must be normalized (e.g. `topScroll`, not `scroll`).
+   * Can be called on any thread.
+   */
+  void setEventCoalescingPolicy(
+      std::string const &type,
+      EventCoalescingPolicy const &policy) const;
+
 #pragma mark - Event listeners
   /*
    * Adds provided event listener to the event dispatcher.
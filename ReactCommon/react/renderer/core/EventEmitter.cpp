@@ -31,11 +31,6 @@ static std::string normalizeEventType(std::string type) {
   return prefixedType;
 }
 
-std::mutex &EventEmitter::DispatchMutex() {
-  static std::mutex mutex;
-  return mutex;
-}
-
 ValueFactory EventEmitter::defaultPayloadFactory() {
   static auto payloadFactory =
       ValueFactory{[](jsi::Runtime &runtime) { return jsi::Object(runtime); }};
@@ -49,16 +44,35 @@ EventEmitter::EventEmitter(
     : eventTarget_(std::move(eventTarget)),
       eventDispatcher_(std::move(eventDispatcher)) {}
 
+/*
+ * Wraps a `folly::dynamic` payload into a `ValueFactory`.
+ * The payload is stored behind a shared pointer, so copies of the factory
+ * (which happen along the way to the event queue) do not deep-copy it.
+ */
+static ValueFactory dynamicPayloadFactory(folly::dynamic &&payload) {
+  auto sharedPayload =
+      std::make_shared<folly::dynamic const>(std::move(payload));
+  return [sharedPayload](jsi::Runtime &runtime) {
+    return valueFromDynamic(runtime, *sharedPayload);
+  };
+}
+
 void EventEmitter::dispatchEvent(
     std::string type,
     const folly::dynamic &payload,
     EventPriority priority,
     RawEvent::Category category) const {
+  dispatchEvent(std::move(type), folly::dynamic(payload), priority, category);
+}
+
+void EventEmitter::dispatchEvent(
+    std::string type,
+    folly::dynamic &&payload,
+    EventPriority priority,
+    RawEvent::Category category) const {
   dispatchEvent(
       std::move(type),
-      [payload](jsi::Runtime &runtime) {
-        return valueFromDynamic(runtime, payload);
-      },
+      dynamicPayloadFactory(std::move(payload)),
       priority,
       category);
 }
@@ -66,9 +80,14 @@ void EventEmitter::dispatchEvent(
 void EventEmitter::dispatchUniqueEvent(
     std::string type,
     const folly::dynamic &payload) const {
-  dispatchUniqueEvent(std::move(type), [payload](jsi::Runtime &runtime) {
-    return valueFromDynamic(runtime, payload);
-  });
+  dispatchUniqueEvent(std::move(type), folly::dynamic(payload));
+}
+
+void EventEmitter::dispatchUniqueEvent(
+    std::string type,
+    folly::dynamic &&payload) const {
+  dispatchUniqueEvent(
+      std::move(type), dynamicPayloadFactory(std::move(payload)));
 }
 
 void EventEmitter::dispatchEvent(
@@ -87,11 +106,31 @@ void EventEmitter::dispatchEvent(
       RawEvent(
           normalizeEventType(std::move(type)),
           payloadFactory,
-          eventTarget_,
+          getEventTarget(),
           category),
       priority);
 }
 
+void EventEmitter::dispatchEvent(
+    EventBatch &batch,
+    std::string type,
+    const ValueFactory &payloadFactory,
+    RawEvent::PackedPayloadFactory packedPayloadFactory,
+    RawEvent::Category category) const {
+  auto eventDispatcher = eventDispatcher_.lock();
+  if (!eventDispatcher) {
+    return;
+  }
+
+  auto rawEvent = RawEvent(
+      normalizeEventType(std::move(type)),
+      payloadFactory,
+      getEventTarget(),
+      category);
+  rawEvent.packedPayloadFactory = std::move(packedPayloadFactory);
+  batch.append(std::move(eventDispatcher), std::move(rawEvent));
+}
+
 void EventEmitter::dispatchUniqueEvent(
     std::string type,
     const ValueFactory &payloadFactory) const {
@@ -105,18 +144,26 @@ void EventEmitter::dispatchUniqueEvent(
   eventDispatcher->dispatchUniqueEvent(RawEvent(
       normalizeEventType(std::move(type)),
       payloadFactory,
-      eventTarget_,
+      getEventTarget(),
       RawEvent::Category::Continuous));
 }
 
+SharedEventTarget EventEmitter::getEventTarget() const {
+  return std::atomic_load(&eventTarget_);
+}
+
 void EventEmitter::setEnabled(bool enabled) const {
   enableCounter_ += enabled ? 1 : -1;
 
+  // Only this method (serialized per surface) writes `eventTarget_`, so a
+  // plain snapshot is enough to make the decisions below.
+  auto eventTarget = getEventTarget();
+
   bool shouldBeEnabled = enableCounter_ > 0;
   if (isEnabled_ != shouldBeEnabled) {
     isEnabled_ = shouldBeEnabled;
-    if (eventTarget_) {
-      eventTarget_->setEnabled(isEnabled_);
+    if (eventTarget) {
+      eventTarget->setEnabled(isEnabled_);
     }
   }
 
@@ -125,9 +172,9 @@ void EventEmitter::setEnabled(bool enabled) const {
   // this to support an initial nebula state where the event target must be
   // retained without any associated mounted node.
   bool shouldBeRetained = enableCounter_ > 0;
-  if (shouldBeRetained != (eventTarget_ != nullptr)) {
+  if (shouldBeRetained != (eventTarget != nullptr)) {
     if (!shouldBeRetained) {
-      eventTarget_.reset();
+      std::atomic_store(&eventTarget_, SharedEventTarget{});
     }
   }
 }
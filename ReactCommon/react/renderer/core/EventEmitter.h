@@ -8,9 +8,9 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 
 #include <folly/dynamic.h>
+#include <react/renderer/core/EventBatch.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/EventPriority.h>
 #include <react/renderer/core/EventTarget.h>
@@ -33,8 +33,6 @@ class EventEmitter {
  public:
   using Shared = std::shared_ptr<EventEmitter const>;
 
-  static std::mutex &DispatchMutex();
-
   static ValueFactory defaultPayloadFactory();
 
   EventEmitter(
@@ -52,7 +50,10 @@ class EventEmitter {
    * a possibility to extract JSI value from it.
    * The enable state is additive; a number of `enable` calls should be equal to
    * a number of `disable` calls to release the event target.
-   * `DispatchMutex` must be acquired before calling.
+   * Calls for a particular event emitter must be serialized by the caller; in
+   * practice that is the commit lock of the `ShadowTree` (i.e. the surface)
+   * the node belongs to, so different surfaces never contend with each other.
+   * Can run concurrently with `dispatchEvent` on any thread.
    */
   void setEnabled(bool enabled) const;
 
@@ -74,15 +75,42 @@ class EventEmitter {
       EventPriority priority = EventPriority::AsynchronousBatched,
       RawEvent::Category category = RawEvent::Category::Unspecified) const;
 
+  /*
+   * Dispatches an event with a `folly::dynamic` payload which is converted to
+   * a JSI value on the JavaScript thread. Prefer typed `ValueFactory` payload
+   * builders (that construct `jsi::Object`s directly) for high-frequency
+   * events; use the rvalue overloads to avoid copying the payload.
+   */
   void dispatchEvent(
       std::string type,
       const folly::dynamic &payload,
       EventPriority priority = EventPriority::AsynchronousBatched,
       RawEvent::Category category = RawEvent::Category::Unspecified) const;
 
+  void dispatchEvent(
+      std::string type,
+      folly::dynamic &&payload,
+      EventPriority priority = EventPriority::AsynchronousBatched,
+      RawEvent::Category category = RawEvent::Category::Unspecified) const;
+
+  /*
+   * Same as `dispatchEvent`, but instead of dispatching the event right away,
+   * appends it to the given `batch` which dispatches accumulated events all
+   * at once. The optional `packedPayloadFactory` allows to deliver the event
+   * to JavaScript along with the other events of the batch in a single call.
+   */
+  void dispatchEvent(
+      EventBatch &batch,
+      std::string type,
+      const ValueFactory &payloadFactory,
+      RawEvent::PackedPayloadFactory packedPayloadFactory = nullptr,
+      RawEvent::Category category = RawEvent::Category::Unspecified) const;
+
   void dispatchUniqueEvent(std::string type, const folly::dynamic &payload)
       const;
 
+  void dispatchUniqueEvent(std::string type, folly::dynamic &&payload) const;
+
   void dispatchUniqueEvent(
       std::string type,
       const ValueFactory &payloadFactory =
@@ -91,13 +119,20 @@ class EventEmitter {
  private:
   void toggleEventTargetOwnership_() const;
 
+  /*
+   * Returns the retained event target (or `nullptr` if the emitter is
+   * disabled). Can be called on any thread.
+   */
+  SharedEventTarget getEventTarget() const;
+
   friend class UIManagerBinding;
 
+  // Must be accessed via `std::atomic_load` and `std::atomic_store` only.
   mutable SharedEventTarget eventTarget_;
 
   EventDispatcher::Weak eventDispatcher_;
-  mutable int enableCounter_{0};
-  mutable bool isEnabled_{false};
+  mutable int enableCounter_{0}; // Protected by the owning surface commit.
+  mutable bool isEnabled_{false}; // Protected by the owning surface commit.
 };
 
 } // namespace react
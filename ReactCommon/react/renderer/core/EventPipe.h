@@ -9,9 +9,11 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 #include <jsi/jsi.h>
 #include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/ReactEventPriority.h>
 #include <react/renderer/core/ValueFactory.h>
 
@@ -25,5 +27,15 @@ using EventPipe = std::function<void(
     ReactEventPriority priority,
     const ValueFactory &payloadFactory)>;
 
+/*
+ * Delivers consecutive events of the same `type` which all have a
+ * `packedPayloadFactory` (in order).
+ */
+using PackedEventPipe = std::function<void(
+    jsi::Runtime &runtime,
+    const std::string &type,
+    ReactEventPriority priority,
+    const std::vector<const RawEvent *> &events)>;
+
 } // namespace react
 } // namespace facebook
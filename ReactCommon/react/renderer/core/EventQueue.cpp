@@ -25,36 +25,60 @@ EventQueue::EventQueue(
 void EventQueue::enqueueEvent(RawEvent &&rawEvent) const {
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
-    eventQueue_.push_back(std::move(rawEvent));
+    if (!enqueueCoalescedEvent(rawEvent)) {
+      eventQueue_.push_back(std::move(rawEvent));
+    }
   }
 
   onEnqueue();
 }
 
-void EventQueue::enqueueUniqueEvent(RawEvent &&rawEvent) const {
+void EventQueue::enqueueEvents(std::vector<RawEvent> &&rawEvents) const {
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
 
-    auto repeatedEvent = eventQueue_.rend();
-
-    for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-      if (it->type == rawEvent.type &&
-          it->eventTarget == rawEvent.eventTarget) {
-        repeatedEvent = it;
-        break;
-      } else if (it->eventTarget == rawEvent.eventTarget) {
-        // It is necessary to maintain order of different event types
-        // for the same target. If the same target has event types A1, B1
-        // in the event queue and event A2 occurs. A1 has to stay in the
-        // queue.
-        break;
+    if (eventQueue_.empty() && coalescingPolicies_.empty()) {
+      eventQueue_ = std::move(rawEvents);
+    } else {
+      eventQueue_.reserve(eventQueue_.size() + rawEvents.size());
+      for (auto &rawEvent : rawEvents) {
+        if (!enqueueCoalescedEvent(rawEvent)) {
+          eventQueue_.push_back(std::move(rawEvent));
+        }
       }
     }
+  }
 
-    if (repeatedEvent == eventQueue_.rend()) {
-      eventQueue_.push_back(std::move(rawEvent));
-    } else {
-      *repeatedEvent = std::move(rawEvent);
+  onEnqueue();
+}
+
+void EventQueue::enqueueUniqueEvent(RawEvent &&rawEvent) const {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+
+    // A registered coalescing policy supersedes the default behaviour.
+    if (!enqueueCoalescedEvent(rawEvent)) {
+      auto repeatedEvent = eventQueue_.rend();
+
+      for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
+        if (it->type == rawEvent.type &&
+            it->eventTarget == rawEvent.eventTarget) {
+          repeatedEvent = it;
+          break;
+        } else if (it->eventTarget == rawEvent.eventTarget) {
+          // It is necessary to maintain order of different event types
+          // for the same target. If the same target has event types A1, B1
+          // in the event queue and event A2 occurs. A1 has to stay in the
+          // queue.
+          break;
+        }
+      }
+
+      if (repeatedEvent == eventQueue_.rend()) {
+        eventQueue_.push_back(std::move(rawEvent));
+      } else {
+        *repeatedEvent = std::move(rawEvent);
+      }
     }
   }
 
@@ -76,6 +100,120 @@ void EventQueue::enqueueStateUpdate(StateUpdate &&stateUpdate) const {
   onEnqueue();
 }
 
+void EventQueue::setCoalescingPolicy(
+    std::string const &type,
+    EventCoalescingPolicy policy) const {
+  std::lock_guard<std::mutex> lock(queueMutex_);
+  coalescingPolicies_[type] = std::move(policy);
+
+  hasSampledPolicies_ = false;
+  for (auto const &pair : coalescingPolicies_) {
+    if (pair.second.kind == EventCoalescingPolicy::Kind::Sampled) {
+      hasSampledPolicies_ = true;
+    }
+  }
+}
+
+bool EventQueue::enqueueCoalescedEvent(RawEvent &rawEvent) const {
+  if (coalescingPolicies_.empty() || !rawEvent.eventTarget) {
+    return false;
+  }
+
+  auto policyIterator = coalescingPolicies_.find(rawEvent.type);
+  if (policyIterator == coalescingPolicies_.end()) {
+    return false;
+  }
+
+  auto const &policy = policyIterator->second;
+  auto key = CoalescingKey{rawEvent.eventTarget.get(), rawEvent.type};
+  auto pendingIterator = pendingCoalescedEvents_.find(key);
+
+  if (pendingIterator == pendingCoalescedEvents_.end()) {
+    pendingCoalescedEvents_.emplace(std::move(key), eventQueue_.size());
+  } else {
+    auto &pendingEvent = eventQueue_[pendingIterator->second];
+
+    if (policy.kind == EventCoalescingPolicy::Kind::Accumulate &&
+        policy.accumulator) {
+      rawEvent.payloadFactory = policy.accumulator(
+          pendingEvent.payloadFactory, rawEvent.payloadFactory);
+      // The packed payload cannot be accumulated.
+      rawEvent.packedPayloadFactory = nullptr;
+    }
+
+    // Turning the pending event into a tombstone; the merged event goes to the
+    // end of the queue to preserve the ordering with other events.
+    pendingEvent.type.clear();
+    pendingEvent.eventTarget.reset();
+    pendingEvent.payloadFactory = ValueFactory{};
+    pendingEvent.packedPayloadFactory = nullptr;
+    hasTombstones_ = true;
+
+    pendingIterator->second = eventQueue_.size();
+  }
+
+  eventQueue_.push_back(std::move(rawEvent));
+  return true;
+}
+
+bool EventQueue::filterCoalescedEvents(std::vector<RawEvent> &queue) const {
+  auto now = std::chrono::steady_clock::now();
+  auto hasDeferredEvents = false;
+
+  auto filteredQueue = std::vector<RawEvent>{};
+  filteredQueue.reserve(queue.size());
+
+  for (auto &event : queue) {
+    if (event.type.empty() && !event.eventTarget) {
+      // Tombstone of a superseded event.
+      continue;
+    }
+
+    if (hasSampledPolicies_ && event.eventTarget) {
+      auto policyIterator = coalescingPolicies_.find(event.type);
+      if (policyIterator != coalescingPolicies_.end() &&
+          policyIterator->second.kind ==
+              EventCoalescingPolicy::Kind::Sampled) {
+        auto key = CoalescingKey{event.eventTarget.get(), event.type};
+        auto lastDelivery = lastSampledDeliveries_.find(key);
+
+        if (lastDelivery != lastSampledDeliveries_.end() &&
+            now - lastDelivery->second <
+                policyIterator->second.samplingInterval) {
+          // Too early; the event waits in the queue for one of the following
+          // beats (and still can be superseded by newer events).
+          pendingCoalescedEvents_[std::move(key)] = eventQueue_.size();
+          eventQueue_.push_back(std::move(event));
+          hasDeferredEvents = true;
+          continue;
+        }
+
+        lastSampledDeliveries_[std::move(key)] = now;
+      }
+    }
+
+    filteredQueue.push_back(std::move(event));
+  }
+
+  if (hasSampledPolicies_) {
+    // Forgetting deliveries which cannot affect sampling anymore; this keeps
+    // the map from growing with targets which are gone.
+    for (auto it = lastSampledDeliveries_.begin();
+         it != lastSampledDeliveries_.end();) {
+      auto policyIterator = coalescingPolicies_.find(it->first.second);
+      if (policyIterator == coalescingPolicies_.end() ||
+          now - it->second >= policyIterator->second.samplingInterval) {
+        it = lastSampledDeliveries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  queue = std::move(filteredQueue);
+  return hasDeferredEvents;
+}
+
 void EventQueue::onBeat(jsi::Runtime &runtime) const {
   flushStateUpdates();
   flushEvents(runtime);
@@ -83,6 +221,7 @@ void EventQueue::onBeat(jsi::Runtime &runtime) const {
 
 void EventQueue::flushEvents(jsi::Runtime &runtime) const {
   std::vector<RawEvent> queue;
+  bool hasDeferredEvents = false;
 
   {
     std::lock_guard<std::mutex> lock(queueMutex_);
@@ -93,6 +232,22 @@ void EventQueue::flushEvents(jsi::Runtime &runtime) const {
 
     queue = std::move(eventQueue_);
     eventQueue_.clear();
+    pendingCoalescedEvents_.clear();
+
+    if (hasTombstones_ || hasSampledPolicies_) {
+      hasTombstones_ = false;
+      hasDeferredEvents = filterCoalescedEvents(queue);
+    }
+  }
+
+  if (hasDeferredEvents) {
+    // Only requesting (not inducing) the next beat; inducing could flush the
+    // deferred events synchronously and recursively right away.
+    eventBeat_->request();
+  }
+
+  if (queue.empty()) {
+    return;
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
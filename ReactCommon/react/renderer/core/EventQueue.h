@@ -9,10 +9,15 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <folly/hash/Hash.h>
 #include <jsi/jsi.h>
 #include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventCoalescingPolicy.h>
 #include <react/renderer/core/EventQueueProcessor.h>
 #include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/StateUpdate.h>
@@ -33,10 +38,19 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatch a given event.
+   * If a coalescing policy is registered for the type of the event, the event
+   * is merged with a pending one of the same type and target.
    * Can be called on any thread.
    */
   void enqueueEvent(RawEvent &&rawEvent) const;
 
+  /*
+   * Same as `enqueueEvent`, but acquires the queue lock and requests the beat
+   * only once for all given events.
+   * Can be called on any thread.
+   */
+  void enqueueEvents(std::vector<RawEvent> &&rawEvents) const;
+
   /*
    * Enqueues and (probably later) dispatches a given event.
    * Deletes last RawEvent from the queue if it has the same type and target.
@@ -50,6 +64,14 @@ class EventQueue {
    */
   void enqueueStateUpdate(StateUpdate &&stateUpdate) const;
 
+  /*
+   * Registers a coalescing policy for events of a given (normalized, e.g.
+   * `topScroll`) type. Replaces a previously registered policy.
+   * Can be called on any thread.
+   */
+  void setCoalescingPolicy(std::string const &type, EventCoalescingPolicy policy)
+      const;
+
  protected:
   /*
    * Called on any enqueue operation.
@@ -62,6 +84,21 @@ class EventQueue {
   void flushEvents(jsi::Runtime &runtime) const;
   void flushStateUpdates() const;
 
+  /*
+   * Enqueues the event according to the coalescing policy of its type.
+   * Returns `false` (and does not touch the event) if there is no policy.
+   * Must be called with `queueMutex_` acquired.
+   */
+  bool enqueueCoalescedEvent(RawEvent &rawEvent) const;
+
+  /*
+   * Removes events superseded by newer ones from the `queue` and moves
+   * sampled events which are too early back to `eventQueue_`.
+   * Returns `true` if some events were deferred to a following beat.
+   * Must be called with `queueMutex_` acquired.
+   */
+  bool filterCoalescedEvents(std::vector<RawEvent> &queue) const;
+
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
@@ -70,6 +107,30 @@ class EventQueue {
   mutable std::vector<StateUpdate> stateUpdateQueue_;
   mutable std::mutex queueMutex_;
   mutable bool hasContinuousEventStarted_{false};
+
+  using CoalescingKey = std::pair<EventTarget const *, std::string>;
+
+  struct CoalescingKeyHash {
+    size_t operator()(CoalescingKey const &key) const {
+      return folly::hash::hash_combine(key.first, key.second);
+    }
+  };
+
+  // Protected by `queueMutex_`.
+  mutable std::unordered_map<std::string, EventCoalescingPolicy>
+      coalescingPolicies_;
+  mutable bool hasSampledPolicies_{false};
+  // Indices of coalesced events in `eventQueue_`.
+  mutable std::unordered_map<CoalescingKey, size_t, CoalescingKeyHash>
+      pendingCoalescedEvents_;
+  // Superseded events are left in `eventQueue_` as tombstones (with an empty
+  // `type` and no target) to keep the enqueuing O(1).
+  mutable bool hasTombstones_{false};
+  mutable std::unordered_map<
+      CoalescingKey,
+      std::chrono::steady_clock::time_point,
+      CoalescingKeyHash>
+      lastSampledDeliveries_;
 };
 
 } // namespace react
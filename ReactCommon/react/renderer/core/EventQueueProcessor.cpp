@@ -15,23 +15,42 @@ namespace react {
 
 EventQueueProcessor::EventQueueProcessor(
     EventPipe eventPipe,
-    StatePipe statePipe)
-    : eventPipe_(std::move(eventPipe)), statePipe_(std::move(statePipe)) {}
+    StatePipe statePipe,
+    PackedEventPipe packedEventPipe)
+    : eventPipe_(std::move(eventPipe)),
+      statePipe_(std::move(statePipe)),
+      packedEventPipe_(std::move(packedEventPipe)) {}
+
+/*
+ * Returns whether `event` can be delivered via a `PackedEventPipe` in the run
+ * of events starting at `firstEvent` (which may be `event` itself). Events
+ * starting or ending a continuous event are never packed as they change the
+ * priority of the following events.
+ */
+static bool canPack(RawEvent const &event, RawEvent const &firstEvent) {
+  return event.packedPayloadFactory && event.type == firstEvent.type &&
+      event.category == firstEvent.category &&
+      event.category != RawEvent::Category::ContinuousStart &&
+      event.category != RawEvent::Category::ContinuousEnd;
+}
 
 void EventQueueProcessor::flushEvents(
     jsi::Runtime &runtime,
     std::vector<RawEvent> &&events) const {
-  {
-    std::lock_guard<std::mutex> lock(EventEmitter::DispatchMutex());
-
-    for (const auto &event : events) {
-      if (event.eventTarget) {
-        event.eventTarget->retain(runtime);
-      }
+  // `EventTarget::retain` consults the thread-safe `enabled` flag of the
+  // target, so no lock is required here even if the targets are being
+  // enabled or disabled concurrently by commits on other threads.
+  for (const auto &event : events) {
+    if (event.eventTarget) {
+      event.eventTarget->retain(runtime);
     }
   }
 
-  for (auto const &event : events) {
+  auto packedEvents = std::vector<RawEvent const *>{};
+
+  for (size_t i = 0; i < events.size(); i++) {
+    auto const &event = events[i];
+
     if (event.category == RawEvent::Category::ContinuousEnd) {
       hasContinuousEventStarted_ = false;
     }
@@ -48,6 +67,17 @@ void EventQueueProcessor::flushEvents(
       reactPriority = ReactEventPriority::Discrete;
     }
 
+    if (packedEventPipe_ && canPack(event, event)) {
+      packedEvents.clear();
+      packedEvents.push_back(&event);
+      while (i + 1 < events.size() && canPack(events[i + 1], event)) {
+        packedEvents.push_back(&events[++i]);
+      }
+
+      packedEventPipe_(runtime, event.type, reactPriority, packedEvents);
+      continue;
+    }
+
     eventPipe_(
         runtime,
         event.eventTarget.get(),
@@ -60,10 +90,8 @@ void EventQueueProcessor::flushEvents(
     }
   }
 
-  // No need to lock `EventEmitter::DispatchMutex()` here.
-  // The mutex protects from a situation when the `instanceHandle` can be
-  // deallocated during accessing, but that's impossible at this point because
-  // we have a strong pointer to it.
+  // The `instanceHandle` cannot be deallocated at this point because we have
+  // a strong pointer to it.
   for (const auto &event : events) {
     if (event.eventTarget) {
       event.eventTarget->release(runtime);
@@ -20,7 +20,14 @@ namespace react {
 
 class EventQueueProcessor {
  public:
-  EventQueueProcessor(EventPipe eventPipe, StatePipe statePipe);
+  /*
+   * Runs of events with packed payloads are delivered via `packedEventPipe`
+   * if it's provided, or one by one via `eventPipe` otherwise.
+   */
+  EventQueueProcessor(
+      EventPipe eventPipe,
+      StatePipe statePipe,
+      PackedEventPipe packedEventPipe = nullptr);
 
   void flushEvents(jsi::Runtime &runtime, std::vector<RawEvent> &&events) const;
   void flushStateUpdates(std::vector<StateUpdate> &&states) const;
@@ -28,6 +35,7 @@ class EventQueueProcessor {
  private:
   EventPipe const eventPipe_;
   StatePipe const statePipe_;
+  PackedEventPipe const packedEventPipe_;
 
   mutable bool hasContinuousEventStarted_{false};
 };
@@ -259,6 +259,10 @@ Size LayoutableShadowNode::measureContent(
   return Size();
 }
 
+void LayoutableShadowNode::premeasureContent(
+    LayoutContext const &layoutContext,
+    LayoutConstraints const &layoutConstraints) const {}
+
 Size LayoutableShadowNode::measure(
     LayoutContext const &layoutContext,
     LayoutConstraints const &layoutConstraints) const {
@@ -81,6 +81,18 @@ class LayoutableShadowNode : public ShadowNode {
       LayoutContext const &layoutContext,
       LayoutConstraints const &layoutConstraints) const;
 
+  /*
+   * Measures the content of the node ahead of the layout pass (which is
+   * going to call `measureContent` with probably the same constraints) to
+   * warm up measurement caches; the result is discarded.
+   * Can be called concurrently for different nodes on any thread, so the
+   * implementation must not mutate the node (including `mutable` caches).
+   * Default implementation does nothing.
+   */
+  virtual void premeasureContent(
+      LayoutContext const &layoutContext,
+      LayoutConstraints const &layoutConstraints) const;
+
   /*
    * Measures the node with given `layoutContext` and `layoutConstraints`.
    * The size of nested content and the padding should be included, the margin
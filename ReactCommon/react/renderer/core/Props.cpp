@@ -8,6 +8,7 @@
 #include "Props.h"
 
 #include <folly/dynamic.h>
+#include <react/renderer/core/DynamicPropsUtilities.h>
 #include <react/renderer/core/propsConversions.h>
 
 namespace facebook {
@@ -15,6 +16,17 @@ namespace react {
 
 bool Props::enablePropIteratorSetter = false;
 
+#ifdef ANDROID
+bool Props::enableRawPropsSerialization = false;
+
+static folly::dynamic retainedRawProps(folly::dynamic rawProps) {
+  if (Props::enableRawPropsSerialization) {
+    return serializeDynamicProps(rawProps);
+  }
+  return rawProps;
+}
+#endif
+
 Props::Props(
     const PropsParserContext &context,
     const Props &sourceProps,
@@ -32,7 +44,7 @@ Props::Props(
 #ifdef ANDROID
       ,
       rawProps(
-          shouldSetRawProps ? (folly::dynamic)rawProps
+          shouldSetRawProps ? retainedRawProps((folly::dynamic)rawProps)
                             : /* null */ folly::dynamic())
 #endif
 {
@@ -50,5 +62,22 @@ void Props::setProp(
   }
 }
 
+#ifdef ANDROID
+folly::dynamic Props::getRawProps() const {
+  return deserializeDynamicProps(rawProps);
+}
+
+bool Props::hasRawProps() const {
+  if (rawProps.isString()) {
+    return rawProps.getString() != "{}";
+  }
+  return rawProps.isObject() && !rawProps.empty();
+}
+
+void Props::setRawProps(folly::dynamic rawProps) {
+  this->rawProps = retainedRawProps(std::move(rawProps));
+}
+#endif
+
 } // namespace react
 } // namespace facebook
@@ -64,6 +64,31 @@ class Props : public virtual Sealable, public virtual DebugStringConvertible {
   int const revision{0};
 
 #ifdef ANDROID
+  /*
+   * Keeps `rawProps` serialized as a JSON string instead of as an object,
+   * which takes a fraction of the memory for the lifetime of the node, at the
+   * cost of serializing them when the props are created and parsing them
+   * when they are sent to the mounting layer.
+   */
+  static bool enableRawPropsSerialization;
+
+  /*
+   * Returns `rawProps` as an object.
+   */
+  folly::dynamic getRawProps() const;
+
+  /*
+   * Returns whether `rawProps` has any prop, whether it is serialized or not
+   * (an empty object is serialized as "{}").
+   */
+  bool hasRawProps() const;
+
+  /*
+   * Sets `rawProps` to the `rawProps` object, serialized if
+   * `enableRawPropsSerialization` is set.
+   */
+  void setRawProps(folly::dynamic rawProps);
+
   folly::dynamic rawProps = folly::dynamic::object();
 #endif
 };
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropsInternPool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <folly/hash/Hash.h>
+
+namespace facebook {
+namespace react {
+
+Props::Shared PropsInternPool::intern(
+    PropsParserContext const &context,
+    Props::Shared const &sourceProps,
+    RawProps const &rawProps,
+    std::function<Props::Shared()> const &createProps) {
+  // Clones without raw props are made to be mutated right away (e.g. by
+  // layout animations or interpolation), so they are never shared. Props
+  // which are set via `iterateOverValues` don't only depend on the parsed
+  // values.
+  if (rawProps.isEmpty() || rawProps.getParsedValueCount() == 0 ||
+      Props::enablePropIteratorSetter ||
+      propsKeepRawProps_.load(std::memory_order_relaxed)) {
+    return createProps();
+  }
+
+  auto hash = folly::hash::hash_combine(
+      context.surfaceId, sourceProps.get(), rawProps.getParsedValuesHash());
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    statistics_.lookups++;
+    if (auto props = find(hash, context.surfaceId, sourceProps, rawProps)) {
+      statistics_.hits++;
+      return props;
+    }
+  }
+
+  // Created without holding the lock, as parsing is the slow part.
+  auto props = createProps();
+
+#ifdef ANDROID
+  // Merged into by `ShadowNode::propsForClonedShadowNode`, so must not be
+  // shared.
+  if (props->hasRawProps()) {
+    propsKeepRawProps_.store(true, std::memory_order_relaxed);
+    return props;
+  }
+#endif
+
+  auto rawPropsValues = rawProps.getParsedValues();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (auto existingProps =
+          find(hash, context.surfaceId, sourceProps, rawProps)) {
+    return existingProps;
+  }
+  if (entries_.size() >= sweepThreshold_) {
+    removeExpiredEntries();
+    // Also shrinks after large lists go away, as expired entries keep the
+    // memory of props allocated along with their control block.
+    sweepThreshold_ = std::max(kMinimumSweepThreshold, entries_.size() * 2);
+  }
+  entries_.emplace(
+      hash,
+      Entry{
+          context.surfaceId,
+          sourceProps.get(),
+          sourceProps,
+          std::move(rawPropsValues),
+          props});
+  return props;
+}
+
+PropsInternPool::Statistics PropsInternPool::getStatistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return statistics_;
+}
+
+Props::Shared PropsInternPool::find(
+    size_t hash,
+    SurfaceId surfaceId,
+    Props::Shared const &sourceProps,
+    RawProps const &rawProps) const {
+  auto range = entries_.equal_range(hash);
+  for (auto it = range.first; it != range.second; it++) {
+    auto const &entry = it->second;
+    // A source pointer can only be compared while the source is alive, as its
+    // address may be reused afterwards.
+    if (entry.surfaceId == surfaceId &&
+        entry.sourcePointer == sourceProps.get() &&
+        (!sourceProps || !entry.source.expired()) &&
+        rawProps.hasParsedValues(entry.rawPropsValues)) {
+      if (auto props = entry.props.lock()) {
+        return props;
+      }
+    }
+  }
+  return nullptr;
+}
+
+void PropsInternPool::removeExpiredEntries() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto const &entry = it->second;
+    if (entry.props.expired() ||
+        (entry.sourcePointer != nullptr && entry.source.expired())) {
+      it = entries_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+} // namespace react
+} // namespace facebook
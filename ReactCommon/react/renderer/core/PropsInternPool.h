@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Shares props objects which are identical between the shadow nodes of a
+ * component, e.g. the rows of a list which all have the same style.
+ *
+ * A props object is entirely determined by the props it's cloned from, the
+ * parsed values of the raw props applied on top of them and the surface, so
+ * those (rather than the content of the props object itself) are used as a
+ * key. The raw props are not converted: entries keep a copy of their parsed
+ * values, which are compared before sharing props, as their hash alone may
+ * collide. The pool only keeps weak references to props: an entry lives as
+ * long as some node uses its props.
+ *
+ * Props objects returned by the pool may be shared by several nodes of a
+ * surface, so they must never be mutated (even before being sealed), except
+ * in ways that give the same result for all of them (see
+ * `YogaLayoutableShadowNode::swapLeftAndRightInViewProps`). Thread-safe.
+ */
+class PropsInternPool final {
+ public:
+  struct Statistics {
+    size_t lookups{0};
+    size_t hits{0};
+  };
+
+  /*
+   * Returns the props created from `sourceProps` and `rawProps` (which must be
+   * parsed) if some are still alive, or the ones returned by `createProps`
+   * otherwise. Props cloned from raw props without any parsed value, props
+   * set via `RawProps::iterateOverValues` and, on Android, props which keep
+   * their raw props are never shared.
+   */
+  Props::Shared intern(
+      PropsParserContext const &context,
+      Props::Shared const &sourceProps,
+      RawProps const &rawProps,
+      std::function<Props::Shared()> const &createProps);
+
+  Statistics getStatistics() const;
+
+ private:
+  struct Entry {
+    SurfaceId surfaceId;
+    Props const *sourcePointer;
+    std::weak_ptr<Props const> source;
+    RawProps::ParsedValues rawPropsValues;
+    std::weak_ptr<Props const> props;
+  };
+
+  Props::Shared find(
+      size_t hash,
+      SurfaceId surfaceId,
+      Props::Shared const &sourceProps,
+      RawProps const &rawProps) const;
+
+  void removeExpiredEntries();
+
+  static constexpr size_t kMinimumSweepThreshold = 64;
+
+  // Set once props created by the component turn out to keep their raw props,
+  // which is the case for all of them or none.
+  std::atomic<bool> propsKeepRawProps_{false};
+
+  mutable std::mutex mutex_;
+  std::unordered_multimap<size_t, Entry> entries_; // Protected by `mutex_`.
+  size_t sweepThreshold_{kMinimumSweepThreshold}; // Protected by `mutex_`.
+  Statistics statistics_{}; // Protected by `mutex_`.
+};
+
+} // namespace react
+} // namespace facebook
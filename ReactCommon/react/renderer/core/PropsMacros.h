@@ -9,6 +9,8 @@
 
 #include <react/renderer/core/RawPropsPrimitives.h>
 
+#include <type_traits>
+
 // We need to use clang pragmas inside of a macro below,
 // so we need to pull out the "if" statement here.
 #if __clang__
@@ -45,7 +47,7 @@
     struct, field, fieldNameString, value)              \
   case CONSTEXPR_RAW_PROPS_KEY_HASH(fieldNameString): { \
     if (!value.hasValue()) {                            \
-      decltype(struct) defaultValues{};                 \
+      std::decay_t<decltype(struct)> defaultValues{};   \
       struct.field = defaultValues.field;               \
       return;                                           \
     }                                                   \
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <react/renderer/core/EventTarget.h>
 #include <react/renderer/core/ValueFactory.h>
@@ -58,6 +60,14 @@ struct RawEvent {
     Continuous = 4
   };
 
+  /*
+   * Appends the payload of the event as a fixed number of values to a buffer
+   * shared by consecutive events of the same type, or returns `false` (and
+   * appends nothing) if the event is cancelled, like a `payloadFactory`
+   * returning `null` does. Is called on the JavaScript thread.
+   */
+  using PackedPayloadFactory = std::function<bool(std::vector<double> &)>;
+
   RawEvent(
       std::string type,
       ValueFactory payloadFactory,
@@ -68,6 +78,13 @@ struct RawEvent {
   ValueFactory payloadFactory;
   SharedEventTarget eventTarget;
   Category category;
+
+  /*
+   * Optional packed form of `payloadFactory` (e.g. for `layout` events of all
+   * nodes affected by a commit), which allows to deliver a run of such events
+   * to JavaScript in a single call. Only one of the two factories is called.
+   */
+  PackedPayloadFactory packedPayloadFactory;
 };
 
 } // namespace react
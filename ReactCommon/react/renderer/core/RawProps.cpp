@@ -7,6 +7,7 @@
 
 #include "RawProps.h"
 
+#include <folly/hash/Hash.h>
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsParser.h>
@@ -93,6 +94,72 @@ const RawValue *RawProps::at(
   return parser_->at(*this, RawPropsKey{prefix, name, suffix});
 }
 
+size_t RawProps::getParsedValueCount() const noexcept {
+  react_native_assert(
+      parser_ &&
+      "The object is not parsed. `parse` must be called before "
+      "`getParsedValueCount`.");
+  return values_.size();
+}
+
+size_t RawProps::getParsedValuesHash() const {
+  react_native_assert(
+      parser_ &&
+      "The object is not parsed. `parse` must be called before "
+      "`getParsedValuesHash`.");
+  size_t hash = values_.size();
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex_.size();
+       keyIndex++) {
+    auto valueIndex = keyIndexToValueIndex_[keyIndex];
+    if (valueIndex != kRawPropsValueIndexEmpty) {
+      hash = folly::hash::hash_combine(
+          hash, keyIndex, values_[valueIndex].dynamic_.hash());
+    }
+  }
+  return hash;
+}
+
+RawProps::ParsedValues RawProps::getParsedValues() const {
+  react_native_assert(
+      parser_ &&
+      "The object is not parsed. `parse` must be called before "
+      "`getParsedValues`.");
+  auto parsedValues = ParsedValues{};
+  parsedValues.reserve(values_.size());
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex_.size();
+       keyIndex++) {
+    auto valueIndex = keyIndexToValueIndex_[keyIndex];
+    if (valueIndex != kRawPropsValueIndexEmpty) {
+      parsedValues.emplace_back(keyIndex, values_[valueIndex].dynamic_);
+    }
+  }
+  return parsedValues;
+}
+
+bool RawProps::hasParsedValues(ParsedValues const &parsedValues) const {
+  react_native_assert(
+      parser_ &&
+      "The object is not parsed. `parse` must be called before "
+      "`hasParsedValues`.");
+  if (parsedValues.size() != values_.size()) {
+    return false;
+  }
+  auto it = parsedValues.begin();
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex_.size();
+       keyIndex++) {
+    auto valueIndex = keyIndexToValueIndex_[keyIndex];
+    if (valueIndex == kRawPropsValueIndexEmpty) {
+      continue;
+    }
+    if (it == parsedValues.end() || it->first != keyIndex ||
+        it->second != values_[valueIndex].dynamic_) {
+      return false;
+    }
+    it++;
+  }
+  return it == parsedValues.end();
+}
+
 void RawProps::iterateOverValues(
     std::function<
         void(RawPropsPropNameHash, const char *, RawValue const &)> const &fn)
@@ -19,6 +19,7 @@
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
 #include <react/renderer/core/RawValue.h>
+#include <utility>
 #include <vector>
 
 namespace facebook {
@@ -97,6 +98,41 @@ class RawProps final {
   const RawValue *at(char const *name, char const *prefix, char const *suffix)
       const noexcept;
 
+  /*
+   * Returns the number of props known to the parser which have a value.
+   * Must be called after `parse`.
+   */
+  size_t getParsedValueCount() const noexcept;
+
+  /*
+   * Returns a hash of the values of the props known to the parser, and of the
+   * props they belong to. Unless they are set via `iterateOverValues`, props
+   * objects parsed from raw props only depend on those values.
+   * Must be called after `parse`.
+   */
+  size_t getParsedValuesHash() const;
+
+  /*
+   * Values of the props known to the parser, along with the indices of the
+   * props they belong to.
+   */
+  using ParsedValues = std::vector<std::pair<size_t, folly::dynamic>>;
+
+  /*
+   * Returns a copy of the values of the props known to the parser which have
+   * a value, which `hasParsedValues` can compare with those of other raw
+   * props parsed by the same parser.
+   * Must be called after `parse`.
+   */
+  ParsedValues getParsedValues() const;
+
+  /*
+   * Returns whether the values of the props known to the parser are equal to
+   * `parsedValues`, without copying them.
+   * Must be called after `parse`.
+   */
+  bool hasParsedValues(ParsedValues const &parsedValues) const;
+
   /**
    * Iterator functions: for when you want to iterate over values in-order
    * instead of using `at` to access values randomly.
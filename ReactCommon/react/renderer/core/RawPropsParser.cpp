@@ -123,23 +123,39 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
       auto count = names.size(runtime);
       auto valueIndex = RawPropsValueIndex{0};
 
+      // Only the values of the props the component knows about are read,
+      // all of them with a single call into the runtime.
+      auto propNames = std::vector<jsi::PropNameID>{};
+      propNames.reserve(count);
+
       for (size_t i = 0; i < count; i++) {
         auto nameValue = names.getValueAtIndex(runtime, i).getString(runtime);
-        auto value = object.getProperty(runtime, nameValue);
-
-        auto name = nameValue.utf8(runtime);
 
-        auto keyIndex = nameToIndex_.at(
-            name.data(), static_cast<RawPropsPropNameLength>(name.size()));
+        // The name is looked up in place, without copying it out of the
+        // runtime.
+        auto keyIndex = kRawPropsValueIndexEmpty;
+        nameValue.withUtf8(runtime, [&](char const *name, size_t length) {
+          keyIndex = nameToIndex_.at(
+              name, static_cast<RawPropsPropNameLength>(length));
+        });
 
         if (keyIndex == kRawPropsValueIndexEmpty) {
           continue;
         }
 
         rawProps.keyIndexToValueIndex_[keyIndex] = valueIndex;
+        propNames.push_back(jsi::PropNameID::forString(runtime, nameValue));
+        valueIndex++;
+      }
+
+      auto values = std::vector<jsi::Value>(propNames.size());
+      object.getProperties(
+          runtime, propNames.data(), values.data(), propNames.size());
+
+      rawProps.values_.reserve(values.size());
+      for (auto const &value : values) {
         rawProps.values_.push_back(
             RawValue(jsi::dynamicFromValue(runtime, value)));
-        valueIndex++;
       }
 
       break;
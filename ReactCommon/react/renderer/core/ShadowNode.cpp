@@ -41,11 +41,11 @@ Props::Shared ShadowNode::propsForClonedShadowNode(
     Props::Shared const &props) {
 #ifdef ANDROID
   bool hasBeenMounted = sourceShadowNode.hasBeenMounted_;
-  bool sourceNodeHasRawProps = !sourceShadowNode.getProps()->rawProps.empty();
+  bool sourceNodeHasRawProps = sourceShadowNode.getProps()->hasRawProps();
   if (!hasBeenMounted && sourceNodeHasRawProps && props) {
     auto &castedProps = const_cast<Props &>(*props);
-    castedProps.rawProps = mergeDynamicProps(
-        sourceShadowNode.getProps()->rawProps, props->rawProps);
+    castedProps.setRawProps(mergeDynamicProps(
+        sourceShadowNode.getProps()->getRawProps(), props->getRawProps()));
     return props;
   }
 #endif
@@ -170,7 +170,7 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
   /*
    * Performs all side effects associated with mounting/unmounting in one place.
    * This is not `virtual` on purpose, do not override this.
-   * `EventEmitter::DispatchMutex()` must be acquired before calling.
+   * Must be called under the commit lock of the owning `ShadowTree`.
    */
   void setMounted(bool mounted) const;
 
@@ -142,3 +142,69 @@ TEST(ComponentDescriptorTest, appendChild) {
   EXPECT_EQ(node1Children.at(0), node2);
   EXPECT_EQ(node1Children.at(1), node3);
 }
+
+TEST(ComponentDescriptorTest, internProps) {
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert("EnablePropsInterning", true);
+  SharedComponentDescriptor descriptor =
+      std::make_shared<TestComponentDescriptor>(ComponentDescriptorParameters{
+          eventDispatcher, contextContainer, nullptr});
+
+  PropsParserContext parserContext{-1, *contextContainer};
+  folly::dynamic rawPropsDynamic = folly::dynamic::object("nativeID", "abc");
+
+  Props::Shared props = descriptor->cloneProps(
+      parserContext, nullptr, RawProps(rawPropsDynamic));
+  Props::Shared sameProps = descriptor->cloneProps(
+      parserContext, nullptr, RawProps(rawPropsDynamic));
+  EXPECT_EQ(sameProps, props);
+
+  folly::dynamic otherRawPropsDynamic = folly::dynamic::object("nativeID", "x");
+  Props::Shared otherProps = descriptor->cloneProps(
+      parserContext, nullptr, RawProps(otherRawPropsDynamic));
+  EXPECT_NE(otherProps, props);
+  EXPECT_STREQ(otherProps->nativeId.c_str(), "x");
+
+  folly::dynamic updateDynamic = folly::dynamic::object("testID", "t");
+  Props::Shared clonedProps =
+      descriptor->cloneProps(parserContext, props, RawProps(updateDynamic));
+  EXPECT_NE(clonedProps, props);
+  EXPECT_EQ(
+      descriptor->cloneProps(parserContext, props, RawProps(updateDynamic)),
+      clonedProps);
+
+  // Clones without raw props may be mutated, so they are never shared.
+  auto clonedButSameProps =
+      descriptor->cloneProps(parserContext, props, RawProps());
+  EXPECT_NE(clonedButSameProps, props);
+  EXPECT_NE(
+      descriptor->cloneProps(parserContext, props, RawProps()),
+      clonedButSameProps);
+
+  // Only the parsed values matter, not the order of the raw props.
+  folly::dynamic orderedDynamic =
+      folly::dynamic::object("nativeID", "abc")("testID", "t");
+  folly::dynamic reorderedDynamic =
+      folly::dynamic::object("testID", "t")("nativeID", "abc");
+  Props::Shared orderedProps = descriptor->cloneProps(
+      parserContext, nullptr, RawProps(orderedDynamic));
+  EXPECT_EQ(
+      descriptor->cloneProps(
+          parserContext, nullptr, RawProps(reorderedDynamic)),
+      orderedProps);
+
+  // Raw props without any prop known to the component are not shared.
+  folly::dynamic unknownDynamic = folly::dynamic::object("unknownProp", 1);
+  Props::Shared unknownProps = descriptor->cloneProps(
+      parserContext, nullptr, RawProps(unknownDynamic));
+  EXPECT_NE(
+      descriptor->cloneProps(parserContext, nullptr, RawProps(unknownDynamic)),
+      unknownProps);
+
+  PropsParserContext otherSurfaceParserContext{1, *contextContainer};
+  EXPECT_NE(
+      descriptor->cloneProps(
+          otherSurfaceParserContext, nullptr, RawProps(rawPropsDynamic)),
+      props);
+}
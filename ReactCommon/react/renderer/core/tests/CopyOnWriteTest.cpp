@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/CopyOnWrite.h>
+
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+using Values = std::vector<int>;
+
+TEST(CopyOnWriteTest, sharesDefaultValue) {
+  auto first = CopyOnWrite<Values>{};
+  auto second = CopyOnWrite<Values>{};
+  auto third = CopyOnWrite<Values>{Values{}};
+
+  EXPECT_TRUE(first->empty());
+  EXPECT_EQ(&first.get(), &second.get());
+  EXPECT_EQ(&first.get(), &third.get());
+
+  // Values which are not equal to the default one get their own block.
+  auto fourth = CopyOnWrite<Values>{Values{1}};
+  EXPECT_NE(&first.get(), &fourth.get());
+
+  // Assigning the default value goes back to the shared block.
+  fourth = Values{};
+  EXPECT_EQ(&first.get(), &fourth.get());
+}
+
+TEST(CopyOnWriteTest, sharesValueBetweenClones) {
+  auto source = CopyOnWrite<Values>{Values{1, 2, 3}};
+
+  auto copy = source;
+  EXPECT_EQ(&source.get(), &copy.get());
+
+  // A clone whose value is equal to the one of its source shares its block.
+  auto clone = CopyOnWrite<Values>{Values{1, 2, 3}, source};
+  EXPECT_EQ(&source.get(), &clone.get());
+
+  auto changedClone = CopyOnWrite<Values>{Values{1, 2}, source};
+  EXPECT_NE(&source.get(), &changedClone.get());
+  EXPECT_EQ(changedClone, (Values{1, 2}));
+  EXPECT_EQ(source, (Values{1, 2, 3}));
+  EXPECT_NE(source, changedClone);
+}
+
+TEST(CopyOnWriteTest, detachesValueOnEdit) {
+  auto source = CopyOnWrite<Values>{Values{1, 2, 3}};
+  auto copy = source;
+  auto defaultValue = CopyOnWrite<Values>{};
+  auto editedDefaultValue = defaultValue;
+
+  copy.edit().push_back(4);
+  EXPECT_NE(&source.get(), &copy.get());
+  EXPECT_EQ(source, (Values{1, 2, 3}));
+  EXPECT_EQ(copy, (Values{1, 2, 3, 4}));
+
+  // Editing a value which isn't shared anymore keeps its block.
+  auto const *editedValue = &copy.get();
+  copy.edit().push_back(5);
+  EXPECT_EQ(&copy.get(), editedValue);
+
+  // The shared default value is never edited in place.
+  editedDefaultValue.edit().push_back(1);
+  EXPECT_TRUE(defaultValue->empty());
+  EXPECT_TRUE(CopyOnWrite<Values>{}->empty());
+  EXPECT_EQ(editedDefaultValue, (Values{1}));
+}
+
+} // namespace react
+} // namespace facebook
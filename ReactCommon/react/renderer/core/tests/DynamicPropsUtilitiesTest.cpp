@@ -64,3 +64,19 @@ TEST(DynamicPropsUtilitiesTest, handleNull) {
 
   EXPECT_TRUE(result["height"].isNull());
 }
+
+TEST(DynamicPropsUtilitiesTest, serializeAndDeserialize) {
+  dynamic props = dynamic::object;
+  props["style"] = dynamic::object("backgroundColor", "red");
+  props["height"] = 100;
+  props["opacity"] = 0.5;
+  props["transform"] = dynamic::array(dynamic::object("scale", 2));
+  props["nativeID"] = nullptr;
+
+  auto serializedProps = serializeDynamicProps(props);
+
+  EXPECT_TRUE(serializedProps.isString());
+  EXPECT_EQ(deserializeDynamicProps(serializedProps), props);
+  EXPECT_EQ(deserializeDynamicProps(props), props);
+  EXPECT_TRUE(deserializeDynamicProps(nullptr).isNull());
+}
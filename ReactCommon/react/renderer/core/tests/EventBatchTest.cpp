@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBatch.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/EventEmitter.h>
+#include <react/renderer/core/EventListener.h>
+#include <react/renderer/core/EventTarget.h>
+
+#include <memory>
+
+namespace facebook {
+namespace react {
+
+class CountingEventBeat : public EventBeat {
+ public:
+  CountingEventBeat(SharedOwnerBox const &ownerBox, int &requestCount)
+      : EventBeat(ownerBox), requestCount_(requestCount) {}
+
+  void request() const override {
+    EventBeat::request();
+    requestCount_++;
+  }
+
+  void fire(jsi::Runtime &runtime) const {
+    beat(runtime);
+  }
+
+ private:
+  int &requestCount_;
+};
+
+class TestEventEmitter : public EventEmitter {
+ public:
+  using EventEmitter::EventEmitter;
+
+  void onTest(EventBatch &batch, int value) const {
+    dispatchEvent(
+        batch,
+        "test",
+        [value](jsi::Runtime &) { return jsi::Value(value); },
+        [value](std::vector<double> &buffer) {
+          buffer.push_back(value);
+          return true;
+        });
+  }
+};
+
+class EventBatchTest : public testing::Test {
+ protected:
+  void createEventDispatcher(bool shouldPackEvents) {
+    auto eventBeatFactory = [this](EventBeat::SharedOwnerBox const &ownerBox) {
+      auto eventBeat =
+          std::make_unique<CountingEventBeat>(ownerBox, requestCount_);
+      eventBeats_.push_back(eventBeat.get());
+      return eventBeat;
+    };
+
+    auto packedEventPipe = PackedEventPipe{};
+    if (shouldPackEvents) {
+      packedEventPipe = [this](
+                            jsi::Runtime &runtime,
+                            std::string const &type,
+                            ReactEventPriority priority,
+                            std::vector<RawEvent const *> const &events) {
+        EXPECT_EQ(type, "topTest");
+        packedCalls_++;
+        auto buffer = std::vector<double>{};
+        for (auto event : events) {
+          deliveredTags_.push_back(event->eventTarget->getTag());
+          ASSERT_TRUE(event->packedPayloadFactory(buffer));
+        }
+        for (auto value : buffer) {
+          deliveredPayloads_.push_back(static_cast<int>(value));
+        }
+      };
+    }
+
+    eventDispatcher_ = std::make_shared<EventDispatcher const>(
+        EventQueueProcessor{
+            [this](
+                jsi::Runtime &runtime,
+                EventTarget const *eventTarget,
+                std::string const &type,
+                ReactEventPriority priority,
+                ValueFactory const &payloadFactory) {
+              EXPECT_EQ(type, "topTest");
+              deliveredTags_.push_back(eventTarget->getTag());
+              deliveredPayloads_.push_back(
+                  static_cast<int>(payloadFactory(runtime).getNumber()));
+            },
+            [](StateUpdate const &) {},
+            packedEventPipe},
+        eventBeatFactory,
+        eventBeatFactory,
+        std::make_shared<EventBeat::OwnerBox>());
+
+    eventListener_ =
+        std::make_shared<EventListener const>([this](RawEvent const &event) {
+          EXPECT_NE(event.eventTarget, nullptr);
+          listenedEvents_++;
+          return false;
+        });
+    eventDispatcher_->addListener(eventListener_);
+
+    for (auto tag = 0; tag < 100; tag++) {
+      instanceHandles_.emplace_back(*runtime_);
+      auto eventTarget = std::make_shared<EventTarget const>(
+          *runtime_, jsi::Value(*runtime_, instanceHandles_.back()), tag);
+      eventEmitters_.push_back(std::make_shared<TestEventEmitter const>(
+          eventTarget, tag, eventDispatcher_));
+      eventEmitters_.back()->setEnabled(true);
+    }
+  }
+
+  void dispatchBatch(int payloadOffset) {
+    auto eventBatch = EventBatch{EventPriority::AsynchronousBatched};
+    for (auto i = 0; i < 100; i++) {
+      eventEmitters_[i]->onTest(eventBatch, payloadOffset + i);
+    }
+    EXPECT_EQ(eventBatch.size(), 100);
+  }
+
+  void beat() {
+    for (auto eventBeat : eventBeats_) {
+      eventBeat->fire(*runtime_);
+    }
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_{
+      facebook::hermes::makeHermesRuntime()};
+  int requestCount_{0};
+  std::vector<CountingEventBeat *> eventBeats_{};
+  std::shared_ptr<EventDispatcher const> eventDispatcher_;
+  std::shared_ptr<EventListener const> eventListener_;
+  std::vector<jsi::Object> instanceHandles_{};
+  std::vector<std::shared_ptr<TestEventEmitter const>> eventEmitters_{};
+
+  int listenedEvents_{0};
+  int packedCalls_{0};
+  std::vector<int> deliveredPayloads_{};
+  std::vector<int> deliveredTags_{};
+};
+
+TEST_F(EventBatchTest, dispatchesAllEventsAtOnce) {
+  createEventDispatcher(false);
+
+  dispatchBatch(0);
+
+  // Each event is queued with its own target, but the beat is requested
+  // only once.
+  EXPECT_EQ(requestCount_, 1);
+  EXPECT_EQ(listenedEvents_, 100);
+
+  beat();
+
+  ASSERT_EQ(deliveredPayloads_.size(), 100);
+  ASSERT_EQ(deliveredTags_.size(), 100);
+  for (auto i = 0; i < 100; i++) {
+    EXPECT_EQ(deliveredPayloads_[i], i);
+    EXPECT_EQ(deliveredTags_[i], i);
+  }
+}
+
+TEST_F(EventBatchTest, deliversPackedPayloadsInSingleCall) {
+  createEventDispatcher(true);
+
+  dispatchBatch(0);
+  beat();
+
+  EXPECT_EQ(packedCalls_, 1);
+  ASSERT_EQ(deliveredPayloads_.size(), 100);
+  ASSERT_EQ(deliveredTags_.size(), 100);
+  for (auto i = 0; i < 100; i++) {
+    EXPECT_EQ(deliveredPayloads_[i], i);
+    EXPECT_EQ(deliveredTags_[i], i);
+  }
+}
+
+TEST_F(EventBatchTest, coalescesEventsOfSeveralBatches) {
+  createEventDispatcher(true);
+  eventDispatcher_->setEventCoalescingPolicy(
+      "topTest", EventCoalescingPolicy::latestWins());
+
+  dispatchBatch(0);
+  dispatchBatch(1000);
+  beat();
+
+  // Only the newest payload of each target is delivered, still in one call.
+  EXPECT_EQ(listenedEvents_, 200);
+  EXPECT_EQ(packedCalls_, 1);
+  ASSERT_EQ(deliveredPayloads_.size(), 100);
+  for (auto i = 0; i < 100; i++) {
+    EXPECT_EQ(deliveredPayloads_[i], 1000 + i);
+    EXPECT_EQ(deliveredTags_[i], i);
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/BatchedEventQueue.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventCoalescingPolicy.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+
+#include <chrono>
+#include <memory>
+
+namespace facebook {
+namespace react {
+
+class ManualEventBeat : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void fire(jsi::Runtime &runtime) const {
+    beat(runtime);
+  }
+};
+
+class EventCoalescingPolicyTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+
+    auto eventPipe = [this](
+                         jsi::Runtime &runtime,
+                         const EventTarget *eventTarget,
+                         const std::string &type,
+                         ReactEventPriority priority,
+                         const ValueFactory &payloadFactory) {
+      deliveredEvents_.push_back(
+          {eventTarget,
+           type,
+           static_cast<int>(payloadFactory(runtime).getNumber())});
+    };
+
+    auto eventBeat = std::make_unique<ManualEventBeat>(
+        std::make_shared<EventBeat::OwnerBox>());
+    eventBeat_ = eventBeat.get();
+
+    eventQueue_ = std::make_unique<BatchedEventQueue>(
+        EventQueueProcessor{eventPipe, [](StateUpdate const &) {}},
+        std::move(eventBeat));
+
+    targetA_ = makeEventTarget(1);
+    targetB_ = makeEventTarget(2);
+  }
+
+  SharedEventTarget makeEventTarget(EventTarget::Tag tag) {
+    return std::make_shared<EventTarget>(
+        *runtime_, jsi::Value(*runtime_, jsi::Object(*runtime_)), tag);
+  }
+
+  RawEvent makeEvent(
+      std::string type,
+      SharedEventTarget const &eventTarget,
+      int payload) {
+    return RawEvent(
+        std::move(type),
+        [payload](jsi::Runtime &) { return jsi::Value(payload); },
+        eventTarget,
+        RawEvent::Category::Continuous);
+  }
+
+  void beat() {
+    eventBeat_->fire(*runtime_);
+  }
+
+  struct DeliveredEvent {
+    EventTarget const *eventTarget;
+    std::string type;
+    int payload;
+  };
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  ManualEventBeat const *eventBeat_;
+  std::unique_ptr<BatchedEventQueue> eventQueue_;
+  std::vector<DeliveredEvent> deliveredEvents_;
+  SharedEventTarget targetA_;
+  SharedEventTarget targetB_;
+};
+
+TEST_F(EventCoalescingPolicyTest, withoutPolicyEveryEventIsDelivered) {
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 1));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 2));
+  beat();
+
+  EXPECT_EQ(deliveredEvents_.size(), 2);
+}
+
+TEST_F(EventCoalescingPolicyTest, latestWinsIgnoresInterleaving) {
+  eventQueue_->setCoalescingPolicy(
+      "topScroll", EventCoalescingPolicy::latestWins());
+
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 1));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetB_, 10));
+  eventQueue_->enqueueEvent(makeEvent("topPress", targetA_, 100));
+  eventQueue_->enqueueUniqueEvent(makeEvent("topScroll", targetA_, 2));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetB_, 20));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 3));
+  beat();
+
+  ASSERT_EQ(deliveredEvents_.size(), 3);
+
+  EXPECT_EQ(deliveredEvents_[0].type, "topPress");
+  EXPECT_EQ(deliveredEvents_[0].payload, 100);
+
+  EXPECT_EQ(deliveredEvents_[1].eventTarget, targetB_.get());
+  EXPECT_EQ(deliveredEvents_[1].payload, 20);
+
+  EXPECT_EQ(deliveredEvents_[2].eventTarget, targetA_.get());
+  EXPECT_EQ(deliveredEvents_[2].payload, 3);
+}
+
+TEST_F(EventCoalescingPolicyTest, accumulateMergesPayloads) {
+  eventQueue_->setCoalescingPolicy(
+      "topPointerMove",
+      EventCoalescingPolicy::accumulate(
+          [](ValueFactory const &previous, ValueFactory const &next) {
+            return ValueFactory{[previous, next](jsi::Runtime &runtime) {
+              return jsi::Value(
+                  previous(runtime).getNumber() + next(runtime).getNumber());
+            }};
+          }));
+
+  eventQueue_->enqueueEvent(makeEvent("topPointerMove", targetA_, 1));
+  eventQueue_->enqueueEvent(makeEvent("topPointerMove", targetB_, 5));
+  eventQueue_->enqueueEvent(makeEvent("topPointerMove", targetA_, 2));
+  eventQueue_->enqueueEvent(makeEvent("topPointerMove", targetA_, 3));
+  beat();
+
+  ASSERT_EQ(deliveredEvents_.size(), 2);
+  EXPECT_EQ(deliveredEvents_[0].payload, 5);
+  EXPECT_EQ(deliveredEvents_[1].payload, 6);
+}
+
+TEST_F(EventCoalescingPolicyTest, sampledDefersTooEarlyEvents) {
+  eventQueue_->setCoalescingPolicy(
+      "topScroll", EventCoalescingPolicy::sampled(std::chrono::hours(1)));
+
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 1));
+  beat();
+
+  ASSERT_EQ(deliveredEvents_.size(), 1);
+
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 2));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetB_, 10));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 3));
+  beat();
+
+  // The event for `targetA_` is too early; only `targetB_` gets delivered.
+  ASSERT_EQ(deliveredEvents_.size(), 2);
+  EXPECT_EQ(deliveredEvents_[1].eventTarget, targetB_.get());
+
+  // The deferred event stays in the queue and keeps being coalesced.
+  eventQueue_->setCoalescingPolicy(
+      "topScroll", EventCoalescingPolicy::sampled(std::chrono::seconds(0)));
+  eventQueue_->enqueueEvent(makeEvent("topScroll", targetA_, 4));
+  beat();
+
+  ASSERT_EQ(deliveredEvents_.size(), 3);
+  EXPECT_EQ(deliveredEvents_[2].eventTarget, targetA_.get());
+  EXPECT_EQ(deliveredEvents_[2].payload, 4);
+}
+
+} // namespace react
+} // namespace facebook
@@ -374,3 +374,42 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->floatValue, 10.0, 0.00001);
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
+
+TEST(RawPropsTest, compareParsedValues) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsPrimitiveTypes>();
+
+  const auto &raw = RawProps(folly::dynamic::object("intValue", 42)(
+      "stringValue", "foo")("unknownValue", true));
+  raw.parse(parser, parserContext);
+
+  // Only the values of props known to the parser are kept.
+  auto parsedValues = raw.getParsedValues();
+  EXPECT_EQ(parsedValues.size(), 2);
+  EXPECT_TRUE(raw.hasParsedValues(parsedValues));
+
+  const auto &same = RawProps(
+      folly::dynamic::object("stringValue", "foo")("intValue", 42));
+  same.parse(parser, parserContext);
+  EXPECT_TRUE(same.hasParsedValues(parsedValues));
+  EXPECT_EQ(same.getParsedValuesHash(), raw.getParsedValuesHash());
+
+  const auto &differentValue = RawProps(
+      folly::dynamic::object("intValue", 42)("stringValue", "bar"));
+  differentValue.parse(parser, parserContext);
+  EXPECT_FALSE(differentValue.hasParsedValues(parsedValues));
+
+  // The same value belonging to another prop is not equal either.
+  const auto &differentProp = RawProps(
+      folly::dynamic::object("intValue", 42)("boolValue", "foo"));
+  differentProp.parse(parser, parserContext);
+  EXPECT_FALSE(differentProp.hasParsedValues(parsedValues));
+
+  const auto &fewerValues = RawProps(folly::dynamic::object("intValue", 42));
+  fewerValues.parse(parser, parserContext);
+  EXPECT_FALSE(fewerValues.hasParsedValues(parsedValues));
+  EXPECT_FALSE(raw.hasParsedValues(fewerValues.getParsedValues()));
+}
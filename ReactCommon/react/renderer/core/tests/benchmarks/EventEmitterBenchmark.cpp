@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/EventEmitter.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+/*
+ * Exposes protected dispatching methods of `EventEmitter`.
+ */
+class BenchmarkEventEmitter : public EventEmitter {
+ public:
+  using EventEmitter::EventEmitter;
+
+  void onScroll() const {
+    dispatchUniqueEvent("scroll");
+  }
+};
+
+/*
+ * An event beat which only beats when the benchmark flushes the surface.
+ */
+class BenchmarkEventBeat : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void flush(jsi::Runtime &runtime) const {
+    beat(runtime);
+  }
+};
+
+/*
+ * Represents the event infrastructure of a single surface: a runtime, a
+ * dispatcher and a number of mounted event emitters with real event targets.
+ */
+struct BenchmarkSurface {
+  BenchmarkSurface(int numberOfEmitters)
+      : runtime(facebook::hermes::makeHermesRuntime()) {
+    auto eventBeatFactory = [this](EventBeat::SharedOwnerBox const &ownerBox) {
+      auto eventBeat = std::make_unique<BenchmarkEventBeat>(ownerBox);
+      eventBeats.push_back(eventBeat.get());
+      return eventBeat;
+    };
+
+    auto ownerBox = std::make_shared<EventBeat::OwnerBox>();
+    eventDispatcher = std::make_shared<EventDispatcher const>(
+        EventQueueProcessor{
+            [](jsi::Runtime &runtime,
+               EventTarget const *eventTarget,
+               std::string const &type,
+               ReactEventPriority priority,
+               ValueFactory const &payloadFactory) {},
+            [](StateUpdate const &stateUpdate) {}},
+        eventBeatFactory,
+        eventBeatFactory,
+        ownerBox);
+    ownerBox->owner = eventDispatcher;
+
+    for (int i = 0; i < numberOfEmitters; i++) {
+      instanceHandles.emplace_back(*runtime);
+      eventTargets.push_back(std::make_shared<EventTarget const>(
+          *runtime, jsi::Value(*runtime, instanceHandles.back()), i));
+      eventEmitters.emplace_back();
+      remount(i);
+    }
+  }
+
+  /*
+   * Unmounts the node at `index` (if any), which disables its event emitter
+   * and releases its event target for good, and mounts a node with a new
+   * event emitter in its place. Unlike with React, the new node reuses the
+   * event target of the old one, which saves creating JavaScript objects.
+   */
+  void remount(int index) {
+    auto &eventEmitter = eventEmitters[index];
+    if (eventEmitter) {
+      eventEmitter->setEnabled(false);
+    }
+    eventEmitter = std::make_shared<BenchmarkEventEmitter const>(
+        eventTargets[index], index, eventDispatcher);
+    eventEmitter->setEnabled(true);
+  }
+
+  /*
+   * Delivers all queued events, as the JavaScript thread does on every beat.
+   * Can be called from any thread.
+   */
+  void flush() {
+    std::lock_guard<std::mutex> lock(runtimeMutex);
+    for (auto eventBeat : eventBeats) {
+      eventBeat->flush(*runtime);
+    }
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime;
+  std::mutex runtimeMutex;
+  std::vector<jsi::Object> instanceHandles;
+  std::vector<SharedEventTarget> eventTargets;
+  std::vector<BenchmarkEventBeat const *> eventBeats;
+  std::shared_ptr<EventDispatcher const> eventDispatcher;
+  std::vector<std::shared_ptr<BenchmarkEventEmitter const>> eventEmitters;
+};
+
+auto const numberOfEmittersPerSurface = 64;
+
+} // namespace
+
+/*
+ * Every thread simulates a separate surface which concurrently remounts nodes
+ * and dispatches continuous events, which the surface delivers once per
+ * iteration. Each node gets an event before and after being unmounted; the
+ * latter has no target anymore. Before the per-target state, all threads
+ * serialized on a single global mutex.
+ */
+static void eventDispatchAcrossSurfaces(benchmark::State &state) {
+  auto surface = BenchmarkSurface{numberOfEmittersPerSurface};
+
+  for (auto _ : state) {
+    for (int i = 0; i < numberOfEmittersPerSurface; i++) {
+      auto eventEmitter = surface.eventEmitters[i];
+      eventEmitter->onScroll();
+      surface.remount(i);
+      eventEmitter->onScroll();
+    }
+    surface.flush();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numberOfEmittersPerSurface * 2);
+}
+BENCHMARK(eventDispatchAcrossSurfaces)
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+/*
+ * All threads dispatch continuous events to the same surface; the only shared
+ * locks are the queue mutex of the surface's event dispatcher and the runtime
+ * the queue is flushed on, once per iteration.
+ */
+static void eventDispatchWithinSurface(benchmark::State &state) {
+  static auto surface = BenchmarkSurface{numberOfEmittersPerSurface};
+
+  for (auto _ : state) {
+    for (auto const &eventEmitter : surface.eventEmitters) {
+      eventEmitter->onScroll();
+    }
+    surface.flush();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numberOfEmittersPerSurface);
+}
+BENCHMARK(eventDispatchWithinSurface)
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <hermes/API/hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <react/renderer/components/scrollview/ScrollViewEventEmitter.h>
+#include <memory>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+auto const scrollViewMetrics = ScrollViewMetrics{
+    Size{320, 8000},
+    Point{0, 1234.5},
+    EdgeInsets{0, 0, 0, 0},
+    Size{320, 640},
+    1.0};
+
+/*
+ * Mirrors what platforms which build payloads as `folly::dynamic` do for
+ * every scroll event.
+ */
+folly::dynamic scrollViewMetricsDynamicPayload(
+    ScrollViewMetrics const &metrics) {
+  return folly::dynamic::object(
+      "contentOffset",
+      folly::dynamic::object("x", metrics.contentOffset.x)(
+          "y", metrics.contentOffset.y))(
+      "contentInset",
+      folly::dynamic::object("top", metrics.contentInset.top)(
+          "left", metrics.contentInset.left)(
+          "bottom", metrics.contentInset.bottom)(
+          "right", metrics.contentInset.right))(
+      "contentSize",
+      folly::dynamic::object("width", metrics.contentSize.width)(
+          "height", metrics.contentSize.height))(
+      "layoutMeasurement",
+      folly::dynamic::object("width", metrics.containerSize.width)(
+          "height", metrics.containerSize.height))(
+      "zoomScale", metrics.zoomScale);
+}
+
+} // namespace
+
+/*
+ * Per-event cost of a `folly::dynamic` payload: building the dynamic on the
+ * platform thread and converting it with `valueFromDynamic` on the JavaScript
+ * thread.
+ */
+static void scrollEventPayloadViaDynamic(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+
+  for (auto _ : state) {
+    auto payload = scrollViewMetricsDynamicPayload(scrollViewMetrics);
+    benchmark::DoNotOptimize(jsi::valueFromDynamic(*runtime, payload));
+  }
+}
+BENCHMARK(scrollEventPayloadViaDynamic);
+
+/*
+ * Per-event cost of a typed payload builder writing directly into
+ * `jsi::Object`s.
+ */
+static void scrollEventPayloadViaTypedBuilder(benchmark::State &state) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        scrollViewMetricsPayload(*runtime, scrollViewMetrics));
+  }
+}
+BENCHMARK(scrollEventPayloadViaTypedBuilder);
+
+} // namespace react
+} // namespace facebook
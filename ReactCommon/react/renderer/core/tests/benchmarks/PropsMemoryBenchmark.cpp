@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/core/DynamicPropsUtilities.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/RawPropsParser.h>
+#include <react/utils/ContextContainer.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+
+// Bytes currently allocated through `operator new`. Replacing the global
+// allocation functions affects the whole binary, which is why this benchmark
+// is built on its own (see `props_memory_benchmark` in BUCK).
+std::atomic<int64_t> liveBytes{0};
+
+size_t allocationSize(void *pointer) {
+#ifdef __APPLE__
+  return malloc_size(pointer);
+#else
+  return malloc_usable_size(pointer);
+#endif
+}
+
+} // namespace
+
+void *operator new(size_t size) {
+  if (auto pointer = std::malloc(size > 0 ? size : 1)) {
+    liveBytes.fetch_add(allocationSize(pointer), std::memory_order_relaxed);
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+  if (pointer != nullptr) {
+    liveBytes.fetch_sub(allocationSize(pointer), std::memory_order_relaxed);
+  }
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  operator delete(pointer);
+}
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr size_t kNumberOfNodes = 1000;
+
+auto const viewPropsDynamic = folly::parseJson(R"({
+  "accessibilityLabel": "Close",
+  "accessibilityRole": "button",
+  "backgroundColor": 4278255360,
+  "borderRadius": 4,
+  "collapsable": false,
+  "flexDirection": "row",
+  "justifyContent": "space-between",
+  "nativeID": "close-button",
+  "opacity": 0.5,
+  "paddingHorizontal": 16,
+  "pointerEvents": "box-none",
+  "testID": "close"
+})");
+
+enum class RawPropsRetention { None, Object, Serialized };
+
+/*
+ * Memory held by `kNumberOfNodes` view props objects, per node. Unless
+ * `retention` is `None`, every object also keeps the props it was created
+ * from, which is what `Props::rawProps` holds on Android unless the mounting
+ * layer serializes typed props (see
+ * `react_native_new_architecture:use_mapbuffer_for_viewprops`): either as
+ * an object or, with `Props::enableRawPropsSerialization`, as JSON.
+ */
+void retainedPropsMemory(
+    benchmark::State &state,
+    RawPropsRetention retention) {
+  auto shouldRetainRawProps = retention != RawPropsRetention::None;
+#ifdef ANDROID
+  Props::enableRawPropsSerialization =
+      retention == RawPropsRetention::Serialized;
+#endif
+  auto parser = RawPropsParser{};
+  parser.prepare<ViewProps>();
+  auto contextContainer = ContextContainer{};
+  auto parserContext = PropsParserContext{-1, contextContainer};
+  auto sourceProps = ViewProps{};
+
+  int64_t bytesPerNode = 0;
+  for (auto _ : state) {
+    auto liveBytesBefore = liveBytes.load(std::memory_order_relaxed);
+    auto props = std::vector<std::shared_ptr<ViewProps const>>{};
+    props.reserve(kNumberOfNodes);
+#ifndef ANDROID
+    auto rawProps = std::vector<folly::dynamic>{};
+    if (shouldRetainRawProps) {
+      rawProps.reserve(kNumberOfNodes);
+    }
+#endif
+    for (size_t i = 0; i < kNumberOfNodes; i++) {
+      auto nodeRawProps = RawProps{viewPropsDynamic};
+      nodeRawProps.parse(parser, parserContext);
+      props.push_back(std::make_shared<ViewProps const>(
+          parserContext, sourceProps, nodeRawProps, shouldRetainRawProps));
+#ifndef ANDROID
+      if (retention == RawPropsRetention::Object) {
+        rawProps.push_back((folly::dynamic)nodeRawProps);
+      } else if (retention == RawPropsRetention::Serialized) {
+        rawProps.push_back(
+            serializeDynamicProps((folly::dynamic)nodeRawProps));
+      }
+#endif
+    }
+    bytesPerNode = (liveBytes.load(std::memory_order_relaxed) -
+                    liveBytesBefore) /
+        static_cast<int64_t>(kNumberOfNodes);
+  }
+  state.counters["bytesPerNode"] = static_cast<double>(bytesPerNode);
+#ifdef ANDROID
+  Props::enableRawPropsSerialization = false;
+#endif
+}
+
+constexpr size_t kNumberOfTreeNodes = 10000;
+
+/*
+ * Props of the `index`-th view of the benchmark tree: one view in ten has
+ * rounded corners and one in twenty a transform, the others set neither.
+ */
+folly::dynamic treeViewPropsDynamic(size_t index) {
+  folly::dynamic props = folly::dynamic::object("backgroundColor", 4278255360)(
+      "flexDirection", "row")("opacity", 1)("paddingHorizontal", 16);
+  if (index % 10 == 0) {
+    props["borderRadius"] = 4;
+  }
+  if (index % 20 == 0) {
+    props["transform"] =
+        folly::dynamic::array(folly::dynamic::object("scale", 2));
+  }
+  return props;
+}
+
+constexpr size_t kNumberOfListRows = 5000;
+
+/*
+ * Props of the two views of the `index`-th row of the benchmark list: the
+ * row itself, which has a unique `testID`, and its card, which has the same
+ * style in all rows but the selected ones.
+ */
+folly::dynamic listRowPropsDynamic(size_t index) {
+  return folly::dynamic::object("testID", "row-" + std::to_string(index))(
+      "flexDirection", "row")("paddingVertical", 8);
+}
+
+folly::dynamic listCardPropsDynamic(size_t index) {
+  return folly::dynamic::object(
+      "backgroundColor", index % 10 == 0 ? 4278190335 : 4294967295)(
+      "borderRadius", 8)("flex", 1)("margin", 4)("opacity", 1);
+}
+
+} // namespace
+
+/*
+ * Memory held by the props of a `kNumberOfListRows` rows list, per row, and
+ * the share of props objects which were reused from other rows.
+ */
+static void listPropsMemory(
+    benchmark::State &state,
+    bool shouldInternProps) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert("EnablePropsInterning", shouldInternProps);
+  auto parserContext = PropsParserContext{-1, *contextContainer};
+
+  int64_t bytesPerRow = 0;
+  double hitRate = 0;
+  for (auto _ : state) {
+    // A new pool for each iteration: the entries of the previous one would
+    // keep the memory of its props (allocated along with their control
+    // blocks) until they are swept.
+    auto componentDescriptor = ViewComponentDescriptor{
+        ComponentDescriptorParameters{{}, contextContainer, nullptr}};
+    auto liveBytesBefore = liveBytes.load(std::memory_order_relaxed);
+    auto props = std::vector<Props::Shared>{};
+    props.reserve(kNumberOfListRows * 2);
+    for (size_t i = 0; i < kNumberOfListRows; i++) {
+      props.push_back(componentDescriptor.cloneProps(
+          parserContext, nullptr, RawProps{listRowPropsDynamic(i)}));
+      props.push_back(componentDescriptor.cloneProps(
+          parserContext, nullptr, RawProps{listCardPropsDynamic(i)}));
+    }
+    bytesPerRow = (liveBytes.load(std::memory_order_relaxed) -
+                   liveBytesBefore) /
+        static_cast<int64_t>(kNumberOfListRows);
+
+    auto uniqueProps = std::unordered_set<Props const *>{};
+    for (auto const &rowProps : props) {
+      uniqueProps.insert(rowProps.get());
+    }
+    hitRate = 1 - static_cast<double>(uniqueProps.size()) / props.size();
+  }
+  state.counters["bytesPerRow"] = static_cast<double>(bytesPerRow);
+  state.counters["hitRate"] = hitRate;
+}
+
+static void listPropsMemoryWithInterning(benchmark::State &state) {
+  listPropsMemory(state, true);
+}
+BENCHMARK(listPropsMemoryWithInterning);
+
+static void listPropsMemoryWithoutInterning(benchmark::State &state) {
+  listPropsMemory(state, false);
+}
+BENCHMARK(listPropsMemoryWithoutInterning);
+
+/*
+ * Memory held by the view props of a `kNumberOfTreeNodes` views tree and of
+ * its next revision, which changes the opacity of every view, per node.
+ */
+static void viewTreePropsMemory(benchmark::State &state) {
+  auto parser = RawPropsParser{};
+  parser.prepare<ViewProps>();
+  auto contextContainer = ContextContainer{};
+  auto parserContext = PropsParserContext{-1, contextContainer};
+  auto emptyProps = ViewProps{};
+  folly::dynamic updateDynamic = folly::dynamic::object("opacity", 0.5);
+
+  int64_t bytesPerNode = 0;
+  for (auto _ : state) {
+    auto liveBytesBefore = liveBytes.load(std::memory_order_relaxed);
+    auto props = std::vector<std::shared_ptr<ViewProps const>>{};
+    props.reserve(kNumberOfTreeNodes * 2);
+    for (size_t i = 0; i < kNumberOfTreeNodes; i++) {
+      auto rawProps = RawProps{treeViewPropsDynamic(i)};
+      rawProps.parse(parser, parserContext);
+      props.push_back(std::make_shared<ViewProps const>(
+          parserContext, emptyProps, rawProps, false));
+    }
+    for (size_t i = 0; i < kNumberOfTreeNodes; i++) {
+      auto rawProps = RawProps{updateDynamic};
+      rawProps.parse(parser, parserContext);
+      props.push_back(std::make_shared<ViewProps const>(
+          parserContext, *props[i], rawProps, false));
+    }
+    bytesPerNode = (liveBytes.load(std::memory_order_relaxed) -
+                    liveBytesBefore) /
+        static_cast<int64_t>(kNumberOfTreeNodes);
+  }
+  state.counters["bytesPerNode"] = static_cast<double>(bytesPerNode);
+  state.counters["sizeofViewProps"] = static_cast<double>(sizeof(ViewProps));
+}
+BENCHMARK(viewTreePropsMemory);
+
+static void retainedPropsMemoryWithRawProps(benchmark::State &state) {
+  retainedPropsMemory(state, RawPropsRetention::Object);
+}
+BENCHMARK(retainedPropsMemoryWithRawProps);
+
+static void retainedPropsMemoryWithSerializedRawProps(
+    benchmark::State &state) {
+  retainedPropsMemory(state, RawPropsRetention::Serialized);
+}
+BENCHMARK(retainedPropsMemoryWithSerializedRawProps);
+
+static void retainedPropsMemoryWithTypedPropsOnly(benchmark::State &state) {
+  retainedPropsMemory(state, RawPropsRetention::None);
+}
+BENCHMARK(retainedPropsMemoryWithTypedPropsOnly);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
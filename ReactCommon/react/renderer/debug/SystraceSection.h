@@ -11,6 +11,10 @@
 #include <fbsystrace.h>
 #endif
 
+#ifdef WITH_TRACE_BUFFER
+#include <reactperflogger/TraceBuffer.h>
+#endif
+
 namespace facebook {
 namespace react {
 
@@ -35,7 +39,7 @@ struct ConcreteSystraceSection {
  private:
   fbsystrace::FbSystraceSection m_section;
 };
-using SystraceSection = ConcreteSystraceSection;
+using PlatformSystraceSection = ConcreteSystraceSection;
 #else
 struct DummySystraceSection {
  public:
@@ -44,7 +48,33 @@ struct DummySystraceSection {
       const char *name,
       ConvertsToStringPiece &&...args) {}
 };
-using SystraceSection = DummySystraceSection;
+using PlatformSystraceSection = DummySystraceSection;
+#endif
+
+/**
+ * If WITH_TRACE_BUFFER is defined, sections are also recorded into the
+ * in-process TraceBuffer (see reactperflogger/TraceBuffer.h), which can be
+ * enabled at runtime and dumped as a Chrome trace.
+ * The TraceBuffer only keeps a pointer to the name, so only string literals
+ * are accepted; sections with other names must use PlatformSystraceSection.
+ */
+#ifdef WITH_TRACE_BUFFER
+template <typename PlatformSection>
+struct TraceBufferSystraceSection {
+ public:
+  template <size_t N, typename... ConvertsToStringPiece>
+  explicit TraceBufferSystraceSection(
+      const char (&name)[N],
+      ConvertsToStringPiece &&...args)
+      : m_traceBufferSection(name), m_section(name, args...) {}
+
+ private:
+  TraceBufferSection m_traceBufferSection;
+  PlatformSection m_section;
+};
+using SystraceSection = TraceBufferSystraceSection<PlatformSystraceSection>;
+#else
+using SystraceSection = PlatformSystraceSection;
 #endif
 
 } // namespace react
@@ -13,6 +13,8 @@
 #endif
 
 #include <condition_variable>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
@@ -20,6 +22,69 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Splits `mutations` into chunks of (at least) `maximumChunkSize` mutations,
+ * returning the (exclusive) end index of every chunk. A chunk is extended
+ * beyond the limit while some view is removed but not inserted back yet, so
+ * a moved view never disappears between two chunks.
+ */
+static std::vector<size_t> calculateChunkEnds(
+    ShadowViewMutation::List const &mutations,
+    size_t maximumChunkSize) {
+  react_native_assert(maximumChunkSize > 0);
+
+  auto chunkEnds = std::vector<size_t>{};
+
+  if (mutations.size() <= maximumChunkSize) {
+    chunkEnds.push_back(mutations.size());
+    return chunkEnds;
+  }
+
+  auto remainingInserts = std::unordered_map<Tag, int>{};
+  for (auto const &mutation : mutations) {
+    if (mutation.type == ShadowViewMutation::Insert) {
+      remainingInserts[mutation.newChildShadowView.tag]++;
+    }
+  }
+
+  auto pendingMoves = std::unordered_set<Tag>{};
+  auto chunkStart = size_t{0};
+
+  for (size_t index = 0; index < mutations.size(); index++) {
+    auto const &mutation = mutations[index];
+
+    switch (mutation.type) {
+      case ShadowViewMutation::Remove: {
+        auto tag = mutation.oldChildShadowView.tag;
+        auto iterator = remainingInserts.find(tag);
+        if (iterator != remainingInserts.end() && iterator->second > 0) {
+          pendingMoves.insert(tag);
+        }
+        break;
+      }
+      case ShadowViewMutation::Insert: {
+        auto tag = mutation.newChildShadowView.tag;
+        remainingInserts[tag]--;
+        pendingMoves.erase(tag);
+        break;
+      }
+      default:
+        break;
+    }
+
+    if (index + 1 - chunkStart >= maximumChunkSize && pendingMoves.empty()) {
+      chunkStart = index + 1;
+      chunkEnds.push_back(chunkStart);
+    }
+  }
+
+  if (chunkStart < mutations.size()) {
+    chunkEnds.push_back(mutations.size());
+  }
+
+  return chunkEnds;
+}
+
 MountingCoordinator::MountingCoordinator(ShadowTreeRevision baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
@@ -35,6 +100,8 @@ SurfaceId MountingCoordinator::getSurfaceId() const {
 }
 
 void MountingCoordinator::push(ShadowTreeRevision const &revision) const {
+  auto baseRootShadowNode = RootShadowNode::Shared{};
+
   {
     std::lock_guard<std::mutex> lock(mutex_);
 
@@ -43,6 +110,34 @@ void MountingCoordinator::push(ShadowTreeRevision const &revision) const {
 
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
       lastRevision_ = revision;
+      preparedTransaction_.reset();
+      baseRootShadowNode = baseRevision_.rootShadowNode;
+    }
+  }
+
+  if (baseRootShadowNode) {
+    // Diffing on the committing thread (outside of the lock), so the consumer
+    // (usually the main thread) does not have to do it.
+    // If more revisions arrive before the pull, each of them is diffed against
+    // the same (mounted) base revision again.
+    auto telemetry = revision.telemetry;
+
+    telemetry.willDiff();
+
+    auto mutations = calculateShadowViewMutations(
+        *baseRootShadowNode, *revision.rootShadowNode);
+
+    telemetry.didDiff();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Storing the mutations only if neither the base revision nor the last
+    // revision have changed in the meantime.
+    if (lastRevision_.has_value() &&
+        lastRevision_->number == revision.number &&
+        baseRevision_.rootShadowNode == baseRootShadowNode) {
+      preparedTransaction_ = PreparedTransaction{
+          revision.number, std::move(mutations), std::move(telemetry)};
     }
   }
 
@@ -57,45 +152,165 @@ void MountingCoordinator::revoke() const {
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+  preparedTransaction_.reset();
+  pendingChunks_.reset();
 }
 
 bool MountingCoordinator::waitForTransaction(
     std::chrono::duration<double> timeout) const {
   std::unique_lock<std::mutex> lock(mutex_);
-  return signal_.wait_for(
-      lock, timeout, [this]() { return lastRevision_.has_value(); });
+  return signal_.wait_for(lock, timeout, [this]() {
+    return lastRevision_.has_value() || pendingChunks_.has_value();
+  });
 }
 
 void MountingCoordinator::updateBaseRevision(
     ShadowTreeRevision const &baseRevision) const {
   baseRevision_ = std::move(baseRevision);
+  preparedTransaction_.reset();
 }
 
 void MountingCoordinator::resetLatestRevision() const {
   lastRevision_.reset();
+  preparedTransaction_.reset();
 }
 
 std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
     const {
   std::lock_guard<std::mutex> lock(mutex_);
 
+  auto transaction = pullFullTransaction();
+
+  if (!pendingChunks_.has_value()) {
+    if (transaction.has_value()) {
+      transaction->getTelemetry().setChunk(
+          0, 1, static_cast<int>(transaction->getMutations().size()));
+    }
+    return transaction;
+  }
+
+  // The rest of the transaction which is being handed out in chunks has to be
+  // mounted before anything else.
+  auto pendingChunks = std::move(*pendingChunks_);
+  pendingChunks_.reset();
+
+  auto chunkStart = pendingChunks.nextChunkIndex == 0
+      ? size_t{0}
+      : pendingChunks.chunkEnds[pendingChunks.nextChunkIndex - 1];
+  auto mutations = ShadowViewMutation::List{
+      std::make_move_iterator(pendingChunks.mutations.begin() + chunkStart),
+      std::make_move_iterator(pendingChunks.mutations.end())};
+
+  auto number = pendingChunks.number;
+  auto telemetry = pendingChunks.telemetry;
+
+  if (transaction.has_value()) {
+    number = transaction->getNumber();
+    telemetry = transaction->getTelemetry();
+    auto transactionMutations = std::move(*transaction).getMutations();
+    mutations.insert(
+        mutations.end(),
+        std::make_move_iterator(transactionMutations.begin()),
+        std::make_move_iterator(transactionMutations.end()));
+  }
+
+  telemetry.setChunk(0, 1, static_cast<int>(mutations.size()));
+
+  return MountingTransaction{
+      surfaceId_, number, std::move(mutations), std::move(telemetry)};
+}
+
+std::optional<MountingTransaction> MountingCoordinator::pullTransactionChunk(
+    size_t maximumChunkSize) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (!pendingChunks_.has_value()) {
+    auto transaction = pullFullTransaction();
+
+    if (!transaction.has_value()) {
+      return {};
+    }
+
+    auto chunkEnds =
+        calculateChunkEnds(transaction->getMutations(), maximumChunkSize);
+
+    if (chunkEnds.size() == 1) {
+      transaction->getTelemetry().setChunk(
+          0, 1, static_cast<int>(transaction->getMutations().size()));
+      return transaction;
+    }
+
+    auto number = transaction->getNumber();
+    auto telemetry = transaction->getTelemetry();
+    pendingChunks_ = PendingChunks{
+        number,
+        std::move(*transaction).getMutations(),
+        std::move(telemetry),
+        std::move(chunkEnds)};
+  }
+
+  auto &pendingChunks = *pendingChunks_;
+  auto chunkIndex = pendingChunks.nextChunkIndex++;
+  auto numberOfChunks = pendingChunks.chunkEnds.size();
+  auto chunkStart =
+      chunkIndex == 0 ? size_t{0} : pendingChunks.chunkEnds[chunkIndex - 1];
+  auto chunkEnd = pendingChunks.chunkEnds[chunkIndex];
+
+  auto mutations = ShadowViewMutation::List{
+      std::make_move_iterator(pendingChunks.mutations.begin() + chunkStart),
+      std::make_move_iterator(pendingChunks.mutations.begin() + chunkEnd)};
+
+  auto telemetry = pendingChunks.telemetry;
+  telemetry.setChunk(
+      static_cast<int>(chunkIndex),
+      static_cast<int>(numberOfChunks),
+      static_cast<int>(mutations.size()));
+
+  auto number = pendingChunks.number;
+
+  if (pendingChunks.nextChunkIndex == numberOfChunks) {
+    pendingChunks_.reset();
+  }
+
+  return MountingTransaction{
+      surfaceId_, number, std::move(mutations), std::move(telemetry)};
+}
+
+bool MountingCoordinator::hasPendingTransactionChunks() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pendingChunks_.has_value();
+}
+
+std::optional<MountingTransaction> MountingCoordinator::pullFullTransaction()
+    const {
   auto transaction = std::optional<MountingTransaction>{};
 
   // Base case
   if (lastRevision_.has_value()) {
     number_++;
 
-    auto telemetry = lastRevision_->telemetry;
+    if (preparedTransaction_.has_value() &&
+        preparedTransaction_->revisionNumber == lastRevision_->number) {
+      transaction = MountingTransaction{
+          surfaceId_,
+          number_,
+          std::move(preparedTransaction_->mutations),
+          preparedTransaction_->telemetry};
+    } else {
+      auto telemetry = lastRevision_->telemetry;
 
-    telemetry.willDiff();
+      telemetry.willDiff();
 
-    auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+      auto mutations = calculateShadowViewMutations(
+          *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
 
-    telemetry.didDiff();
+      telemetry.didDiff();
+
+      transaction = MountingTransaction{
+          surfaceId_, number_, std::move(mutations), telemetry};
+    }
 
-    transaction = MountingTransaction{
-        surfaceId_, number_, std::move(mutations), telemetry};
+    preparedTransaction_.reset();
   }
 
   // Override case
@@ -9,6 +9,7 @@
 
 #include <chrono>
 #include <optional>
+#include <vector>
 
 #include <react/renderer/debug/flags.h>
 #include <react/renderer/mounting/Differentiator.h>
@@ -28,9 +29,10 @@ namespace react {
 /*
  * Stores inside all non-mounted yet revisions of a shadow tree and coordinates
  * mounting. The object stores the most recent mounted revision and the most
- * recent committed one. Then when a new mounting transaction is requested the
- * object generates mutation instructions and returns it as a
- * `MountingTransaction`.
+ * recent committed one. Mutation instructions are computed eagerly when a new
+ * revision is pushed (on the committing thread), so when a new mounting
+ * transaction is requested (usually on the main thread) the object only hands
+ * over the already prepared `MountingTransaction`.
  */
 class MountingCoordinator final {
  public:
@@ -48,7 +50,9 @@ class MountingCoordinator final {
   SurfaceId getSurfaceId() const;
 
   /*
-   * Computes a consequent mounting transaction and returns it.
+   * Returns a consequent mounting transaction. The mutations are usually
+   * computed ahead of time by `push`; if they are not available (e.g. the
+   * pull happened concurrently with the diffing) they are computed here.
    * The returning transaction can accumulate multiple recent revisions of a
    * shadow tree. Returns empty optional if there no new shadow tree revision to
    * mount.
@@ -58,6 +62,30 @@ class MountingCoordinator final {
    */
   std::optional<MountingTransaction> pullTransaction() const;
 
+  /*
+   * Same as `pullTransaction` but splits a big transaction (e.g. the initial
+   * render of a huge surface) into a series of chunks with roughly
+   * `maximumChunkSize` mutations each, which can be mounted in separate
+   * frames. Every call returns the next chunk of the transaction in progress;
+   * a new transaction is pulled only after the previous one is fully handed
+   * out.
+   * Chunks must be mounted in order. Every prefix of the sequence leaves the
+   * view tree consistent: the order of mutations is preserved (so views are
+   * always created before they are inserted and parents are built before
+   * their children are inserted), and a chunk never ends between removing
+   * a view and inserting it back (a move).
+   * Calling `pullTransaction` while chunks are pending returns all remaining
+   * mutations at once.
+   */
+  std::optional<MountingTransaction> pullTransactionChunk(
+      size_t maximumChunkSize) const;
+
+  /*
+   * Returns `true` if a transaction was split by `pullTransactionChunk` and
+   * not all chunks of it were pulled yet.
+   */
+  bool hasPendingTransactionChunks() const;
+
   /*
    * Blocks the current thread until a new mounting transaction is available or
    * after the specified `timeout` duration.
@@ -100,6 +128,14 @@ class MountingCoordinator final {
   void revoke() const;
 
  private:
+  /*
+   * Pulls a whole transaction between `baseRevision_` and `lastRevision_`
+   * (applying the `MountingOverrideDelegate` if any) and makes the last
+   * revision the base one.
+   * Must be called with `mutex_` locked.
+   */
+  std::optional<MountingTransaction> pullFullTransaction() const;
+
   SurfaceId const surfaceId_;
 
   mutable std::mutex mutex_;
@@ -110,6 +146,34 @@ class MountingCoordinator final {
   mutable std::weak_ptr<MountingOverrideDelegate const>
       mountingOverrideDelegate_;
 
+  /*
+   * Mutations (and telemetry) between `baseRevision_` and `lastRevision_`
+   * computed by `push` ahead of `pullTransaction`.
+   */
+  struct PreparedTransaction {
+    ShadowTreeRevision::Number revisionNumber;
+    ShadowViewMutation::List mutations;
+    TransactionTelemetry telemetry;
+  };
+
+  mutable std::optional<PreparedTransaction>
+      preparedTransaction_; // Protected by `mutex_`.
+
+  /*
+   * A transaction split by `pullTransactionChunk` which is being handed out.
+   * `chunkEnds` stores the (exclusive) end index of every chunk.
+   */
+  struct PendingChunks {
+    MountingTransaction::Number number;
+    ShadowViewMutation::List mutations;
+    TransactionTelemetry telemetry;
+    std::vector<size_t> chunkEnds;
+    size_t nextChunkIndex{0};
+  };
+
+  mutable std::optional<PendingChunks>
+      pendingChunks_; // Protected by `mutex_`.
+
   TelemetryController telemetryController_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
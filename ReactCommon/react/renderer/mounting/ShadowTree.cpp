@@ -10,6 +10,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/core/EventBatch.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutPrimitives.h>
 #include <react/renderer/debug/SystraceSection.h>
@@ -356,6 +357,10 @@ CommitStatus ShadowTree::tryCommit(
   std::vector<LayoutableShadowNode const *> affectedLayoutableNodes{};
   affectedLayoutableNodes.reserve(1024);
 
+  telemetry.willPrepareLayout();
+  delegate_.shadowTreeWillLayout(*this, *newRootShadowNode);
+  telemetry.didPrepareLayout();
+
   telemetry.willLayout();
   telemetry.setAsThreadLocal();
   newRootShadowNode->layoutIfNeeded(&affectedLayoutableNodes);
@@ -383,13 +388,12 @@ CommitStatus ShadowTree::tryCommit(
       return CommitStatus::Cancelled;
     }
 
-    {
-      std::lock_guard<std::mutex> dispatchLock(EventEmitter::DispatchMutex());
-
-      updateMountedFlag(
-          currentRevision_.rootShadowNode->getChildren(),
-          newRootShadowNode->getChildren());
-    }
+    // Mounted flags (and thus event emitters' enabled state) of this surface
+    // are protected by `commitMutex_`; event targets are thread-safe on their
+    // own, so no global lock is needed here.
+    updateMountedFlag(
+        currentRevision_.rootShadowNode->getChildren(),
+        newRootShadowNode->getChildren());
 
     telemetry.didCommit();
     telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
@@ -438,6 +442,10 @@ void ShadowTree::emitLayoutEvents(
       "affectedLayoutableNodes",
       affectedLayoutableNodes.size());
 
+  // All layout events of the commit are handed over to the event queue at
+  // once (instead of acquiring the queue lock once per node).
+  auto eventBatch = EventBatch{EventPriority::AsynchronousUnbatched};
+
   for (auto const *layoutableNode : affectedLayoutableNodes) {
     // Only instances of `ViewShadowNode` (and subclasses) are supported.
     auto const &viewShadowNode =
@@ -453,8 +461,10 @@ void ShadowTree::emitLayoutEvents(
       continue;
     }
 
-    viewEventEmitter.onLayout(layoutableNode->getLayoutMetrics());
+    viewEventEmitter.onLayout(layoutableNode->getLayoutMetrics(), eventBatch);
   }
+
+  eventBatch.dispatch();
 }
 
 void ShadowTree::notifyDelegatesOfUpdates() const {
@@ -30,6 +30,16 @@ class ShadowTreeDelegate {
       RootShadowNode::Shared const &oldRootShadowNode,
       RootShadowNode::Unshared const &newRootShadowNode) const = 0;
 
+  /*
+   * Called right before the layout pass of a commit (on the committing
+   * thread). The receiver can warm up caches the layout relies on (e.g.
+   * measure content of dirty nodes ahead of time); it must not mutate the tree
+   * and all work has to be finished before the method returns.
+   */
+  virtual void shadowTreeWillLayout(
+      ShadowTree const &shadowTree,
+      RootShadowNode const &rootShadowNode) const {}
+
   /*
    * Called right after Shadow Tree commit a new state of the tree.
    */
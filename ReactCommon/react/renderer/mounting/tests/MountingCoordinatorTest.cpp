@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <thread>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs.h>
+
+#include <react/renderer/element/testUtils.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class PassThroughShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      ShadowTree const &shadowTree,
+      RootShadowNode::Shared const &oldRootShadowNode,
+      RootShadowNode::Unshared const &newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override{};
+};
+
+/*
+ * Builds a new root of `shadowTree` containing a view with
+ * `numberOfChildren` children.
+ */
+RootShadowNode::Unshared buildRootShadowNode(
+    ComponentBuilder &builder,
+    ShadowTree const &shadowTree,
+    int numberOfChildren) {
+  // Views with default props would be flattened and not mounted at all.
+  auto props = std::make_shared<ViewShadowNodeProps>();
+  props->collapsable = false;
+
+  auto children = std::vector<ElementFragment>{};
+  for (auto i = 0; i < numberOfChildren; i++) {
+    children.push_back(
+        Element<ViewShadowNode>().tag(100 + i).surfaceId(11).props(props));
+  }
+
+  auto containerShadowNode = builder.build(Element<ViewShadowNode>()
+                                               .tag(2)
+                                               .surfaceId(11)
+                                               .props(props)
+                                               .children(children));
+
+  // The root has to stay of the same family as the root of the tree.
+  return std::static_pointer_cast<RootShadowNode>(
+      shadowTree.getCurrentRevision().rootShadowNode->ShadowNode::clone(
+          {ShadowNodeFragment::propsPlaceholder(),
+           std::make_shared<ShadowNode::ListOfShared const>(
+               ShadowNode::ListOfShared{containerShadowNode})}));
+}
+
+void expectEqualMutations(
+    ShadowViewMutation::List const &lhs,
+    ShadowViewMutation::List const &rhs) {
+  ASSERT_EQ(lhs.size(), rhs.size());
+  for (size_t i = 0; i < lhs.size(); i++) {
+    EXPECT_EQ(lhs[i].type, rhs[i].type);
+    EXPECT_EQ(lhs[i].parentShadowView, rhs[i].parentShadowView);
+    EXPECT_EQ(lhs[i].oldChildShadowView, rhs[i].oldChildShadowView);
+    EXPECT_EQ(lhs[i].newChildShadowView, rhs[i].newChildShadowView);
+    EXPECT_EQ(lhs[i].index, rhs[i].index);
+  }
+}
+
+/*
+ * Returns `true` if some view is removed among the first `length` mutations
+ * and inserted back after them, so a chunk must not end there.
+ */
+bool hasPendingMove(ShadowViewMutation::List const &mutations, size_t length) {
+  auto removedTags = std::unordered_set<Tag>{};
+  for (size_t i = 0; i < length; i++) {
+    auto const &mutation = mutations[i];
+    if (mutation.type == ShadowViewMutation::Remove) {
+      removedTags.insert(mutation.oldChildShadowView.tag);
+    }
+    if (mutation.type == ShadowViewMutation::Insert) {
+      removedTags.erase(mutation.newChildShadowView.tag);
+    }
+  }
+  for (size_t i = length; i < mutations.size(); i++) {
+    auto const &mutation = mutations[i];
+    if (mutation.type == ShadowViewMutation::Insert &&
+        removedTags.find(mutation.newChildShadowView.tag) !=
+            removedTags.end()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Pulls all chunks of the pending transaction and checks that a chunk only
+ * exceeds `maximumChunkSize` where it could not end earlier.
+ */
+std::vector<ShadowViewMutation::List> pullAllChunks(
+    MountingCoordinator const &mountingCoordinator,
+    size_t maximumChunkSize) {
+  auto chunks = std::vector<ShadowViewMutation::List>{};
+  auto numberOfChunks = 0;
+
+  do {
+    auto chunk = mountingCoordinator.pullTransactionChunk(maximumChunkSize);
+    EXPECT_TRUE(chunk.has_value());
+    if (!chunk.has_value()) {
+      break;
+    }
+
+    auto const &mutations = chunk->getMutations();
+    auto &telemetry = chunk->getTelemetry();
+    EXPECT_EQ(telemetry.getChunkIndex(), static_cast<int>(chunks.size()));
+    EXPECT_EQ(telemetry.getChunkSize(), static_cast<int>(mutations.size()));
+
+    // A chunk never ends between removing a view and inserting it back, and
+    // is only extended beyond the limit up to the first point where it can
+    // end.
+    EXPECT_FALSE(hasPendingMove(mutations, mutations.size()));
+    for (auto length = maximumChunkSize; length < mutations.size(); length++) {
+      EXPECT_TRUE(hasPendingMove(mutations, length));
+    }
+
+    if (chunks.empty()) {
+      numberOfChunks = telemetry.getNumberOfChunks();
+    }
+    EXPECT_EQ(telemetry.getNumberOfChunks(), numberOfChunks);
+
+    chunks.push_back(mutations);
+  } while (mountingCoordinator.hasPendingTransactionChunks());
+
+  EXPECT_EQ(static_cast<int>(chunks.size()), numberOfChunks);
+  return chunks;
+}
+
+ShadowViewMutation::List concatenateChunks(
+    std::vector<ShadowViewMutation::List> const &chunks) {
+  auto mutations = ShadowViewMutation::List{};
+  for (auto const &chunk : chunks) {
+    mutations.insert(mutations.end(), chunk.begin(), chunk.end());
+  }
+  return mutations;
+}
+
+} // namespace
+
+TEST(MountingCoordinatorTest, transactionIsPreparedOnCommittingThread) {
+  auto builder = simpleComponentBuilder();
+  auto contextContainer = ContextContainer{};
+  auto shadowTreeDelegate = PassThroughShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto initialRevision = shadowTree.getCurrentRevision();
+  auto rootShadowNode = buildRootShadowNode(builder, shadowTree, 10);
+
+  auto committingThread = std::thread([&]() {
+    shadowTree.commit(
+        [&](RootShadowNode const &oldRootShadowNode) {
+          return rootShadowNode;
+        },
+        {true});
+  });
+  auto committingThreadId = committingThread.get_id();
+  committingThread.join();
+
+  auto transaction =
+      shadowTree.getMountingCoordinator()->pullTransaction();
+
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_EQ(
+      transaction->getTelemetry().getDiffThreadId(), committingThreadId);
+
+  auto expectedMutations = calculateShadowViewMutations(
+      *initialRevision.rootShadowNode,
+      *shadowTree.getCurrentRevision().rootShadowNode);
+  EXPECT_EQ(transaction->getMutations().size(), expectedMutations.size());
+
+  // Nothing new to mount.
+  EXPECT_FALSE(
+      shadowTree.getMountingCoordinator()->pullTransaction().has_value());
+}
+
+TEST(MountingCoordinatorTest, laterRevisionsAreDiffedAgainstMountedBase) {
+  auto builder = simpleComponentBuilder();
+  auto contextContainer = ContextContainer{};
+  auto shadowTreeDelegate = PassThroughShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto initialRevision = shadowTree.getCurrentRevision();
+
+  for (auto numberOfChildren : {5, 10, 3}) {
+    auto rootShadowNode =
+        buildRootShadowNode(builder, shadowTree, numberOfChildren);
+    shadowTree.commit(
+        [&](RootShadowNode const &oldRootShadowNode) {
+          return rootShadowNode;
+        },
+        {true});
+  }
+
+  auto transaction =
+      shadowTree.getMountingCoordinator()->pullTransaction();
+
+  ASSERT_TRUE(transaction.has_value());
+
+  auto expectedMutations = calculateShadowViewMutations(
+      *initialRevision.rootShadowNode,
+      *shadowTree.getCurrentRevision().rootShadowNode);
+  EXPECT_EQ(transaction->getMutations().size(), expectedMutations.size());
+}
+
+TEST(MountingCoordinatorTest, transactionIsPulledInConsistentChunks) {
+  auto builder = simpleComponentBuilder();
+  auto contextContainer = ContextContainer{};
+  auto shadowTreeDelegate = PassThroughShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto mountingCoordinator = shadowTree.getMountingCoordinator();
+  auto stubViewTree = buildStubViewTreeWithoutUsingDifferentiator(
+      *shadowTree.getCurrentRevision().rootShadowNode);
+
+  auto baseRootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+  auto rootShadowNode = buildRootShadowNode(builder, shadowTree, 100);
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) { return rootShadowNode; },
+      {true});
+
+  // The chunks, put together, are exactly the transaction they were split
+  // from.
+  auto chunks = pullAllChunks(*mountingCoordinator, 10);
+  EXPECT_GT(chunks.size(), 1);
+
+  auto mutations = concatenateChunks(chunks);
+  expectEqualMutations(
+      mutations,
+      calculateShadowViewMutations(
+          *baseRootShadowNode,
+          *shadowTree.getCurrentRevision().rootShadowNode));
+
+  stubViewTree.mutate(mutations);
+  EXPECT_EQ(
+      stubViewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(
+          *shadowTree.getCurrentRevision().rootShadowNode));
+  EXPECT_FALSE(mountingCoordinator->pullTransactionChunk(10).has_value());
+
+  // Reversing the order of children moves every view, so chunks have to be
+  // extended beyond the limit until the moved views are inserted back.
+  baseRootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+  auto containerShadowNode = rootShadowNode->getChildren().front();
+  auto const &children = containerShadowNode->getChildren();
+  auto reversedChildren = std::make_shared<ShadowNode::ListOfShared const>(
+      children.rbegin(), children.rend());
+
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            oldRootShadowNode.cloneTree(
+                containerShadowNode->getFamily(),
+                [&](ShadowNode const &oldShadowNode) {
+                  return oldShadowNode.clone(
+                      {ShadowNodeFragment::propsPlaceholder(),
+                       reversedChildren});
+                }));
+      },
+      {true});
+
+  chunks = pullAllChunks(*mountingCoordinator, 1);
+  ASSERT_FALSE(chunks.empty());
+  EXPECT_GT(chunks.front().size(), 1);
+
+  mutations = concatenateChunks(chunks);
+  expectEqualMutations(
+      mutations,
+      calculateShadowViewMutations(
+          *baseRootShadowNode,
+          *shadowTree.getCurrentRevision().rootShadowNode));
+
+  stubViewTree.mutate(mutations);
+  EXPECT_EQ(
+      stubViewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(
+          *shadowTree.getCurrentRevision().rootShadowNode));
+}
+
+TEST(MountingCoordinatorTest, pullTransactionFlushesPendingChunks) {
+  auto builder = simpleComponentBuilder();
+  auto contextContainer = ContextContainer{};
+  auto shadowTreeDelegate = PassThroughShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto mountingCoordinator = shadowTree.getMountingCoordinator();
+  auto stubViewTree = buildStubViewTreeWithoutUsingDifferentiator(
+      *shadowTree.getCurrentRevision().rootShadowNode);
+
+  auto rootShadowNode = buildRootShadowNode(builder, shadowTree, 50);
+  shadowTree.commit(
+      [&](RootShadowNode const &oldRootShadowNode) { return rootShadowNode; },
+      {true});
+
+  auto chunk = mountingCoordinator->pullTransactionChunk(10);
+  ASSERT_TRUE(chunk.has_value());
+  ASSERT_TRUE(mountingCoordinator->hasPendingTransactionChunks());
+  stubViewTree.mutate(chunk->getMutations());
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_FALSE(mountingCoordinator->hasPendingTransactionChunks());
+  EXPECT_EQ(transaction->getTelemetry().getNumberOfChunks(), 1);
+  stubViewTree.mutate(transaction->getMutations());
+
+  EXPECT_EQ(
+      stubViewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(
+          *shadowTree.getCurrentRevision().rootShadowNode));
+}
@@ -272,8 +272,8 @@ TEST_F(StackingContextTest, mostPropsDoNotForceViewsToMaterialize) {
     auto &yogaStyle = props.yogaStyle;
     yogaStyle.positionType() = YGPositionTypeRelative;
 
-    props.borderRadii.all = 42;
-    props.borderColors.all = blackColor();
+    props.borderRadii.edit().all = 42;
+    props.borderColors.edit().all = blackColor();
   });
 
   mutateViewShadowNodeProps_(nodeBD_, [](ViewProps &props) {
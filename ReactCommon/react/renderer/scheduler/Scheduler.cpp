@@ -73,6 +73,22 @@ Scheduler::Scheduler(
     }
   };
 
+  auto packedEventPipe = [uiManager, runtimeScheduler = runtimeScheduler.get()](
+                             jsi::Runtime &runtime,
+                             std::string const &type,
+                             ReactEventPriority priority,
+                             std::vector<RawEvent const *> const &events) {
+    uiManager->visitBinding(
+        [&](UIManagerBinding const &uiManagerBinding) {
+          uiManagerBinding.dispatchPackedEvents(
+              runtime, type, priority, events);
+        },
+        runtime);
+    if (runtimeScheduler) {
+      runtimeScheduler->callExpiredTasks(runtime);
+    }
+  };
+
   auto statePipe = [uiManager](StateUpdate const &stateUpdate) {
     uiManager->updateState(stateUpdate);
   };
@@ -80,7 +96,7 @@ Scheduler::Scheduler(
   // Creating an `EventDispatcher` instance inside the already allocated
   // container (inside the optional).
   eventDispatcher_->emplace(
-      EventQueueProcessor(eventPipe, statePipe),
+      EventQueueProcessor(eventPipe, statePipe, packedEventPipe),
       schedulerToolbox.synchronousEventBeatFactory,
       schedulerToolbox.asynchronousEventBeatFactory,
       eventOwnerBox);
@@ -89,11 +105,27 @@ Scheduler::Scheduler(
   auto eventDispatcher =
       EventDispatcher::Shared{eventDispatcher_, &eventDispatcher_->value()};
 
+  if (reactNativeConfig_->getBool(
+          "react_fabric:enable_event_coalescing_policies")) {
+    // High-frequency events where only the most recent payload matters.
+    for (auto type :
+         {"topScroll", "topLayout", "topPointerMove", "topTextLayout"}) {
+      eventDispatcher->setEventCoalescingPolicy(
+          type, EventCoalescingPolicy::latestWins());
+    }
+  }
+
   componentDescriptorRegistry_ = schedulerToolbox.componentRegistryFactory(
       eventDispatcher, contextContainer_);
 
   uiManager->setDelegate(this);
   uiManager->setComponentDescriptorRegistry(componentDescriptorRegistry_);
+#ifndef ANDROID
+  // TextLayoutManager on Android measures text through a shared `TextPaint`,
+  // so it must not be called concurrently.
+  uiManager->setContentPremeasurementEnabled(reactNativeConfig_->getBool(
+      "react_fabric:enable_content_premeasurement"));
+#endif
 
   runtimeExecutor_(
       [uiManager, runtimeExecutor = runtimeExecutor_](jsi::Runtime &runtime) {
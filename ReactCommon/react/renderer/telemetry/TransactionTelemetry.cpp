@@ -51,6 +51,7 @@ void TransactionTelemetry::willDiff() {
   react_native_assert(diffStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ == kTelemetryUndefinedTimePoint);
   diffStartTime_ = now_();
+  diffThreadId_ = std::this_thread::get_id();
 }
 
 void TransactionTelemetry::didDiff() {
@@ -59,6 +60,22 @@ void TransactionTelemetry::didDiff() {
   diffEndTime_ = now_();
 }
 
+void TransactionTelemetry::willPrepareLayout() {
+  react_native_assert(
+      layoutPreparationStartTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      layoutPreparationEndTime_ == kTelemetryUndefinedTimePoint);
+  layoutPreparationStartTime_ = now_();
+}
+
+void TransactionTelemetry::didPrepareLayout() {
+  react_native_assert(
+      layoutPreparationStartTime_ != kTelemetryUndefinedTimePoint);
+  react_native_assert(
+      layoutPreparationEndTime_ == kTelemetryUndefinedTimePoint);
+  layoutPreparationEndTime_ = now_();
+}
+
 void TransactionTelemetry::willLayout() {
   react_native_assert(layoutStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(layoutEndTime_ == kTelemetryUndefinedTimePoint);
@@ -101,6 +118,16 @@ void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setChunk(
+    int chunkIndex,
+    int numberOfChunks,
+    int chunkSize) {
+  react_native_assert(chunkIndex >= 0 && chunkIndex < numberOfChunks);
+  chunkIndex_ = chunkIndex;
+  numberOfChunks_ = numberOfChunks;
+  chunkSize_ = chunkSize;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -137,6 +164,10 @@ TelemetryTimePoint TransactionTelemetry::getLayoutEndTime() const {
   return layoutEndTime_;
 }
 
+std::thread::id TransactionTelemetry::getDiffThreadId() const {
+  return diffThreadId_;
+}
+
 TelemetryTimePoint TransactionTelemetry::getMountStartTime() const {
   react_native_assert(mountStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(mountEndTime_ != kTelemetryUndefinedTimePoint);
@@ -149,6 +180,13 @@ TelemetryTimePoint TransactionTelemetry::getMountEndTime() const {
   return mountEndTime_;
 }
 
+TelemetryDuration TransactionTelemetry::getLayoutPreparationTime() const {
+  if (layoutPreparationEndTime_ == kTelemetryUndefinedTimePoint) {
+    return TelemetryDuration{0};
+  }
+  return layoutPreparationEndTime_ - layoutPreparationStartTime_;
+}
+
 TelemetryDuration TransactionTelemetry::getTextMeasureTime() const {
   return textMeasureTime_;
 }
@@ -161,5 +199,17 @@ int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
 
+int TransactionTelemetry::getChunkIndex() const {
+  return chunkIndex_;
+}
+
+int TransactionTelemetry::getNumberOfChunks() const {
+  return numberOfChunks_;
+}
+
+int TransactionTelemetry::getChunkSize() const {
+  return chunkSize_;
+}
+
 } // namespace react
 } // namespace facebook
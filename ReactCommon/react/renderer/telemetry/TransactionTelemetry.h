@@ -10,6 +10,7 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <thread>
 
 #include <react/utils/Telemetry.h>
 
@@ -40,6 +41,8 @@ class TransactionTelemetry final {
   void didDiff();
   void willCommit();
   void didCommit();
+  void willPrepareLayout();
+  void didPrepareLayout();
   void willLayout();
   void willMeasureText();
   void didMeasureText();
@@ -49,6 +52,12 @@ class TransactionTelemetry final {
 
   void setRevisionNumber(int revisionNumber);
 
+  /*
+   * Describes which part of a transaction that was split into chunks (see
+   * `MountingCoordinator::pullTransactionChunk`) this telemetry belongs to.
+   */
+  void setChunk(int chunkIndex, int numberOfChunks, int chunkSize);
+
   /*
    * Reading
    */
@@ -61,25 +70,53 @@ class TransactionTelemetry final {
   TelemetryTimePoint getMountStartTime() const;
   TelemetryTimePoint getMountEndTime() const;
 
+  /*
+   * Returns the id of the thread the diffing ran on (e.g. to verify that it
+   * did not happen on the main thread).
+   */
+  std::thread::id getDiffThreadId() const;
+
+  /*
+   * Returns the time spent preparing the layout pass (e.g. measuring content
+   * of dirty nodes ahead of time); zero if there was no preparation.
+   * Text measured during the preparation is not included in
+   * `getTextMeasureTime`.
+   */
+  TelemetryDuration getLayoutPreparationTime() const;
+
   TelemetryDuration getTextMeasureTime() const;
   int getNumberOfTextMeasurements() const;
   int getRevisionNumber() const;
 
+  /*
+   * Return `0`, `1`, and the number of mutations in the transaction for
+   * transactions that were not split into chunks.
+   */
+  int getChunkIndex() const;
+  int getNumberOfChunks() const;
+  int getChunkSize() const;
+
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint commitStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint commitEndTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint layoutPreparationStartTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint layoutPreparationEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint layoutStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint layoutEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint mountStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint mountEndTime_{kTelemetryUndefinedTimePoint};
+  std::thread::id diffThreadId_{};
 
   TelemetryTimePoint lastTextMeasureStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryDuration textMeasureTime_{0};
 
   int numberOfTextMeasurements_{0};
   int revisionNumber_{0};
+  int chunkIndex_{0};
+  int numberOfChunks_{1};
+  int chunkSize_{0};
   std::function<TelemetryTimePoint()> now_;
 };
 
@@ -133,6 +133,47 @@ TEST(TransactionTelemetryTest, defaultImplementation) {
   EXPECT_GE(mountDuration, 100);
 }
 
+TEST(TransactionTelemetryTest, diffThreadId) {
+  auto telemetry = TransactionTelemetry{};
+
+  EXPECT_EQ(telemetry.getDiffThreadId(), std::thread::id{});
+
+  auto thread = std::thread([&]() {
+    telemetry.willDiff();
+    telemetry.didDiff();
+  });
+  auto threadId = thread.get_id();
+  thread.join();
+
+  EXPECT_EQ(telemetry.getDiffThreadId(), threadId);
+  EXPECT_NE(telemetry.getDiffThreadId(), std::this_thread::get_id());
+}
+
+TEST(TransactionTelemetryTest, layoutPreparation) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getLayoutPreparationTime()), 0);
+
+  telemetry.willPrepareLayout();
+  MockClock::advance_by(std::chrono::milliseconds(100));
+  telemetry.didPrepareLayout();
+
+  telemetry.setAsThreadLocal();
+  telemetry.willLayout();
+  TransactionTelemetry::threadLocalTelemetry()->willMeasureText();
+  MockClock::advance_by(std::chrono::milliseconds(50));
+  TransactionTelemetry::threadLocalTelemetry()->didMeasureText();
+  telemetry.didLayout();
+  telemetry.unsetAsThreadLocal();
+
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getLayoutPreparationTime()),
+      100);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getTextMeasureTime()), 50);
+}
+
 TEST(TransactionTelemetryTest, abnormalUseCases) {
   // Calling `did` before `will` should crash.
   EXPECT_DEATH_IF_SUPPORTED(
@@ -7,9 +7,463 @@
 
 #include "TextLayoutManager.h"
 
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 namespace facebook {
 namespace react {
 
+namespace {
+
+/*
+ * Advance widths of printable ASCII characters (U+0020...U+007E) in
+ * thousandths of em. The values are the metrics of Helvetica (and the
+ * metric-compatible Arial), so measurements are close to what real platforms
+ * produce for the default sans-serif font.
+ */
+constexpr uint16_t kAsciiAdvances[] = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333,
+    278, 278, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278,
+    584, 584, 584, 556, 1015, 667, 667, 722, 722, 667, 611, 778, 722, 278,
+    500, 667, 556, 833, 722, 778, 667, 778, 722, 667, 611, 722, 667, 944,
+    667, 667, 611, 278, 278, 278, 469, 556, 333, 556, 556, 500, 556, 556,
+    278, 556, 556, 222, 222, 500, 222, 833, 556, 556, 556, 556, 333, 500,
+    278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584};
+
+static_assert(
+    sizeof(kAsciiAdvances) / sizeof(kAsciiAdvances[0]) == 0x7F - 0x20,
+    "Every printable ASCII character must have an advance.");
+
+/*
+ * Vertical metrics (in em) of the same font.
+ */
+constexpr Float kAscender = 0.905;
+constexpr Float kDescender = 0.212;
+constexpr Float kCapHeight = 0.716;
+constexpr Float kXHeight = 0.519;
+
+/*
+ * Emboldening makes glyphs slightly wider.
+ */
+constexpr Float kBoldAdvanceScale = 1.05;
+
+uint16_t advanceOfCodePoint(char32_t codePoint) {
+  if (codePoint >= 0x20 && codePoint < 0x7F) {
+    return kAsciiAdvances[codePoint - 0x20];
+  }
+
+  // Combining marks and zero-width characters.
+  if ((codePoint >= 0x0300 && codePoint <= 0x036F) ||
+      (codePoint >= 0x200B && codePoint <= 0x200F) || codePoint == 0xFEFF) {
+    return 0;
+  }
+
+  // Wide (CJK, Hangul, full-width forms) characters and emoji.
+  if ((codePoint >= 0x1100 && codePoint <= 0x115F) ||
+      (codePoint >= 0x2E80 && codePoint <= 0xA4CF) ||
+      (codePoint >= 0xAC00 && codePoint <= 0xD7A3) ||
+      (codePoint >= 0xF900 && codePoint <= 0xFAFF) ||
+      (codePoint >= 0xFE30 && codePoint <= 0xFE4F) ||
+      (codePoint >= 0xFF00 && codePoint <= 0xFF60) ||
+      (codePoint >= 0xFFE0 && codePoint <= 0xFFE6) ||
+      (codePoint >= 0x1F300 && codePoint <= 0x1FAFF) ||
+      (codePoint >= 0x20000 && codePoint <= 0x3FFFD)) {
+    return 1000;
+  }
+
+  // Everything else gets the width of an average Latin glyph.
+  return 556;
+}
+
+/*
+ * Decodes a UTF-8 sequence starting at `index` and advances `index` past it.
+ * Malformed input is consumed byte by byte as U+FFFD.
+ */
+char32_t decodeCodePoint(std::string const &string, size_t &index) {
+  auto lead = static_cast<unsigned char>(string[index]);
+
+  auto length = size_t{1};
+  auto codePoint = char32_t{lead};
+
+  if (lead >= 0xF0 && lead < 0xF8) {
+    length = 4;
+    codePoint = lead & 0x07;
+  } else if (lead >= 0xE0) {
+    length = 3;
+    codePoint = lead & 0x0F;
+  } else if (lead >= 0xC0) {
+    length = 2;
+    codePoint = lead & 0x1F;
+  } else if (lead >= 0x80) {
+    index += 1;
+    return 0xFFFD;
+  }
+
+  if (index + length > string.size()) {
+    index += 1;
+    return 0xFFFD;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    auto continuation = static_cast<unsigned char>(string[index + i]);
+    if ((continuation & 0xC0) != 0x80) {
+      index += 1;
+      return 0xFFFD;
+    }
+    codePoint = (codePoint << 6) | (continuation & 0x3F);
+  }
+
+  index += length;
+  return codePoint;
+}
+
+/*
+ * The smallest unit of layout: a single code point or an attachment.
+ */
+struct Cluster {
+  enum class Kind {
+    Regular,
+    // A line can be broken after the cluster (e.g. a hyphen).
+    BreakAfter,
+    // A whitespace; a line can be broken after it and trailing whitespaces
+    // do not contribute to the width of the line.
+    Space,
+    // A forced line break.
+    Newline,
+  };
+
+  Kind kind;
+  Float advance;
+  Float ascent;
+  Float descent;
+  Float fontSize;
+  size_t fragmentIndex;
+  size_t offset;
+  size_t length;
+  bool isAttachment;
+};
+
+struct Line {
+  size_t begin;
+  size_t end;
+  Float width;
+  Float ascent;
+  Float descent;
+  Float height;
+  Float fontSize;
+};
+
+struct Layout {
+  std::vector<Cluster> clusters;
+  std::vector<Line> lines;
+  size_t numberOfAttachments{0};
+  Float width{0};
+  Float height{0};
+};
+
+Float effectiveFontSize(TextAttributes const &textAttributes) {
+  auto fontSize = !std::isnan(textAttributes.fontSize)
+      ? textAttributes.fontSize
+      : TextAttributes::defaultTextAttributes().fontSize;
+
+  if (!std::isnan(textAttributes.fontSizeMultiplier) &&
+      textAttributes.allowFontScaling.value_or(true)) {
+    fontSize *= textAttributes.fontSizeMultiplier;
+  }
+
+  return fontSize;
+}
+
+char32_t transformCodePoint(
+    char32_t codePoint,
+    TextTransform textTransform,
+    bool isWordStart) {
+  if (codePoint >= 0x80) {
+    return codePoint;
+  }
+
+  switch (textTransform) {
+    case TextTransform::Uppercase:
+      return std::toupper(static_cast<int>(codePoint));
+    case TextTransform::Lowercase:
+      return std::tolower(static_cast<int>(codePoint));
+    case TextTransform::Capitalize:
+      return isWordStart ? std::toupper(static_cast<int>(codePoint))
+                         : codePoint;
+    default:
+      return codePoint;
+  }
+}
+
+void appendClusters(
+    Layout &layout,
+    AttributedString::Fragment const &fragment,
+    size_t fragmentIndex) {
+  auto const &textAttributes = fragment.textAttributes;
+  auto fontSize = effectiveFontSize(textAttributes);
+  auto ascent = fontSize * kAscender;
+  auto descent = fontSize * kDescender;
+
+  if (fragment.isAttachment()) {
+    auto size = fragment.parentShadowView.layoutMetrics.frame.size;
+    layout.clusters.push_back(Cluster{
+        Cluster::Kind::Regular,
+        size.width,
+        size.height,
+        0,
+        0,
+        fragmentIndex,
+        0,
+        fragment.string.size(),
+        true});
+    layout.numberOfAttachments++;
+    return;
+  }
+
+  auto scale = fontSize / 1000;
+  if (textAttributes.fontWeight.has_value() &&
+      static_cast<int>(*textAttributes.fontWeight) >=
+          static_cast<int>(FontWeight::Semibold)) {
+    scale *= kBoldAdvanceScale;
+  }
+
+  auto letterSpacing = !std::isnan(textAttributes.letterSpacing)
+      ? textAttributes.letterSpacing
+      : Float{0};
+  auto textTransform =
+      textAttributes.textTransform.value_or(TextTransform::None);
+
+  auto const &string = fragment.string;
+  auto isWordStart = true;
+
+  for (size_t index = 0; index < string.size();) {
+    auto offset = index;
+    auto codePoint = decodeCodePoint(string, index);
+
+    auto kind = Cluster::Kind::Regular;
+    switch (codePoint) {
+      case '\n':
+      case 0x2028:
+      case 0x2029:
+        kind = Cluster::Kind::Newline;
+        break;
+      case ' ':
+      case '\t':
+      case 0x200B:
+        kind = Cluster::Kind::Space;
+        break;
+      case '-':
+      case 0x2010:
+      case 0x2013:
+      case 0x2014:
+        kind = Cluster::Kind::BreakAfter;
+        break;
+      default:
+        break;
+    }
+
+    auto advance = Float{0};
+    if (kind != Cluster::Kind::Newline) {
+      codePoint = transformCodePoint(codePoint, textTransform, isWordStart);
+      advance =
+          advanceOfCodePoint(codePoint == '\t' ? ' ' : codePoint) * scale +
+          letterSpacing;
+    }
+
+    isWordStart = kind != Cluster::Kind::Regular;
+
+    layout.clusters.push_back(Cluster{
+        kind,
+        advance,
+        ascent,
+        descent,
+        fontSize,
+        fragmentIndex,
+        offset,
+        index - offset,
+        false});
+  }
+}
+
+void finalizeLine(
+    Layout const &layout,
+    AttributedString::Fragments const &fragments,
+    Line &line) {
+  auto const &clusters = layout.clusters;
+
+  line.ascent = 0;
+  line.descent = 0;
+  line.fontSize = 0;
+  auto lineHeight = Float{0};
+
+  // An empty line takes the metrics of the adjacent (newline) cluster.
+  auto begin = line.begin;
+  auto end = line.end;
+  if (begin == end) {
+    begin = std::min(begin, clusters.size() - 1);
+    end = begin + 1;
+  }
+
+  for (auto index = begin; index < end; index++) {
+    auto const &cluster = clusters[index];
+    line.ascent = std::max(line.ascent, cluster.ascent);
+    line.descent = std::max(line.descent, cluster.descent);
+    line.fontSize = std::max(line.fontSize, cluster.fontSize);
+
+    auto const &textAttributes =
+        fragments[cluster.fragmentIndex].textAttributes;
+    if (!cluster.isAttachment && !std::isnan(textAttributes.lineHeight)) {
+      auto multiplier = !std::isnan(textAttributes.fontSizeMultiplier) &&
+              textAttributes.allowFontScaling.value_or(true)
+          ? textAttributes.fontSizeMultiplier
+          : Float{1};
+      lineHeight = std::max(lineHeight, textAttributes.lineHeight * multiplier);
+    }
+  }
+
+  line.height = line.ascent + line.descent;
+
+  // Similarly to Android, an explicit line height distributes the extra
+  // (or missing) space evenly above and below the glyphs.
+  if (lineHeight > 0) {
+    auto extra = lineHeight - line.height;
+    line.ascent += extra / 2;
+    line.descent += extra / 2;
+    line.height = lineHeight;
+  }
+}
+
+/*
+ * Greedy line breaking: every line takes as many clusters as fit into
+ * `maximumWidth`; lines are broken after whitespaces and hyphens, and inside
+ * a word only if the word alone does not fit into a line.
+ */
+Layout layoutAttributedString(
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    Float maximumWidth) {
+  auto layout = Layout{};
+
+  auto const &fragments = attributedString.getFragments();
+
+  auto numberOfBytes = size_t{0};
+  for (auto const &fragment : fragments) {
+    numberOfBytes += fragment.string.size();
+  }
+  layout.clusters.reserve(numberOfBytes);
+
+  for (size_t index = 0; index < fragments.size(); index++) {
+    appendClusters(layout, fragments[index], index);
+  }
+
+  if (layout.clusters.empty()) {
+    return layout;
+  }
+
+  auto const &clusters = layout.clusters;
+  auto const numberOfClusters = clusters.size();
+  auto const maximumNumberOfLines = paragraphAttributes.maximumNumberOfLines > 0
+      ? static_cast<size_t>(paragraphAttributes.maximumNumberOfLines)
+      : std::numeric_limits<size_t>::max();
+  auto const noBreak = std::numeric_limits<size_t>::max();
+
+  auto lineStart = size_t{0};
+
+  while (layout.lines.size() < maximumNumberOfLines) {
+    auto line = Line{lineStart, numberOfClusters, 0, 0, 0, 0, 0};
+    auto nextLineStart = numberOfClusters;
+    auto isForcedBreak = false;
+
+    auto width = Float{0};
+    auto contentWidth = Float{0};
+    auto breakIndex = noBreak;
+    auto breakWidth = Float{0};
+
+    for (auto index = lineStart; index < numberOfClusters; index++) {
+      auto const &cluster = clusters[index];
+
+      if (cluster.kind == Cluster::Kind::Newline) {
+        line.end = index;
+        nextLineStart = index + 1;
+        isForcedBreak = true;
+        break;
+      }
+
+      if (cluster.kind == Cluster::Kind::Space) {
+        width += cluster.advance;
+        breakIndex = index + 1;
+        breakWidth = contentWidth;
+        continue;
+      }
+
+      if (width + cluster.advance > maximumWidth && index > lineStart) {
+        if (breakIndex != noBreak) {
+          line.end = breakIndex;
+          contentWidth = breakWidth;
+        } else {
+          line.end = index;
+        }
+        nextLineStart = line.end;
+        break;
+      }
+
+      width += cluster.advance;
+      contentWidth = width;
+
+      if (cluster.kind == Cluster::Kind::BreakAfter) {
+        breakIndex = index + 1;
+        breakWidth = contentWidth;
+      }
+    }
+
+    line.width = contentWidth;
+    finalizeLine(layout, fragments, line);
+
+    layout.width = std::max(layout.width, line.width);
+    layout.height += line.height;
+    layout.lines.push_back(line);
+
+    // A forced break at the very end still produces an (empty) last line.
+    if (nextLineStart == numberOfClusters && !isForcedBreak) {
+      break;
+    }
+
+    lineStart = nextLineStart;
+  }
+
+  return layout;
+}
+
+Float horizontalOffsetOfLine(
+    Line const &line,
+    AttributedString const &attributedString,
+    Float containerWidth) {
+  if (line.begin >= line.end || std::isinf(containerWidth)) {
+    return 0;
+  }
+
+  auto const &fragment = attributedString.getFragments().front();
+  auto alignment =
+      fragment.textAttributes.alignment.value_or(TextAlignment::Natural);
+
+  switch (alignment) {
+    case TextAlignment::Center:
+      return (containerWidth - line.width) / 2;
+    case TextAlignment::Right:
+      return containerWidth - line.width;
+    default:
+      return 0;
+  }
+}
+
+} // namespace
+
 void *TextLayoutManager::getNativeTextLayoutManager() const {
   return (void *)this;
 }
@@ -18,22 +472,106 @@ TextMeasurement TextLayoutManager::measure(
     AttributedStringBox attributedStringBox,
     ParagraphAttributes paragraphAttributes,
     LayoutConstraints layoutConstraints) const {
-  TextMeasurement::Attachments attachments;
-  for (auto const &fragment : attributedStringBox.getValue().getFragments()) {
-    if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, false});
+  auto const &attributedString = attributedStringBox.getValue();
+
+  auto measurement = measureCache_.get(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](TextMeasureCacheKey const &key) {
+        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+        if (telemetry) {
+          telemetry->willMeasureText();
+        }
+
+        auto measurement =
+            doMeasure(attributedString, paragraphAttributes, layoutConstraints);
+
+        if (telemetry) {
+          telemetry->didMeasureText();
+        }
+
+        return measurement;
+      });
+
+  measurement.size = layoutConstraints.clamp(measurement.size);
+  return measurement;
+}
+
+TextMeasurement TextLayoutManager::doMeasure(
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    LayoutConstraints const &layoutConstraints) const {
+  auto layout = layoutAttributedString(
+      attributedString,
+      paragraphAttributes,
+      layoutConstraints.maximumSize.width);
+
+  auto attachments = TextMeasurement::Attachments{};
+  attachments.reserve(layout.numberOfAttachments);
+
+  auto top = Float{0};
+  for (auto const &line : layout.lines) {
+    auto left = horizontalOffsetOfLine(line, attributedString, layout.width);
+    auto baseline = top + line.ascent;
+
+    for (auto index = line.begin; index < line.end; index++) {
+      auto const &cluster = layout.clusters[index];
+      if (cluster.isAttachment) {
+        attachments.push_back(TextMeasurement::Attachment{
+            {{left, baseline - cluster.ascent},
+             {cluster.advance, cluster.ascent}},
+            false});
+      }
+      left += cluster.advance;
     }
+
+    top += line.height;
   }
-  return TextMeasurement{{0, 0}, attachments};
+
+  // Attachments which did not fit into `maximumNumberOfLines`.
+  while (attachments.size() < layout.numberOfAttachments) {
+    attachments.push_back(TextMeasurement::Attachment{{{0, 0}, {0, 0}}, true});
+  }
+
+  return TextMeasurement{{layout.width, layout.height}, attachments};
 }
 
 LinesMeasurements TextLayoutManager::measureLines(
     AttributedString attributedString,
     ParagraphAttributes paragraphAttributes,
     Size size) const {
-  return {};
-};
+  auto layout =
+      layoutAttributedString(attributedString, paragraphAttributes, size.width);
+
+  auto const &fragments = attributedString.getFragments();
+
+  auto linesMeasurements = LinesMeasurements{};
+  linesMeasurements.reserve(layout.lines.size());
+
+  auto top = Float{0};
+  for (auto const &line : layout.lines) {
+    auto text = std::string{};
+    for (auto index = line.begin; index < line.end; index++) {
+      auto const &cluster = layout.clusters[index];
+      text.append(
+          fragments[cluster.fragmentIndex].string,
+          cluster.offset,
+          cluster.length);
+    }
+
+    linesMeasurements.push_back(LineMeasurement{
+        std::move(text),
+        {{horizontalOffsetOfLine(line, attributedString, size.width), top},
+         {line.width, line.height}},
+        line.descent,
+        line.fontSize * kCapHeight,
+        line.ascent,
+        line.fontSize * kXHeight});
+
+    top += line.height;
+  }
+
+  return linesMeasurements;
+}
 
 } // namespace react
 } // namespace facebook
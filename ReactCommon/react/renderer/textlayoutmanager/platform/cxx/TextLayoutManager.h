@@ -24,14 +24,18 @@ class TextLayoutManager;
 using SharedTextLayoutManager = std::shared_ptr<const TextLayoutManager>;
 
 /*
- * Cross platform facade for Android-specific TextLayoutManager.
+ * Headless text layout engine for platforms without native text rendering
+ * (e.g. tests and benchmarks running on a desktop).
+ * Measurements are deterministic: glyph advances and vertical metrics come
+ * from a built-in table of a generic sans-serif font, and lines are broken
+ * greedily after whitespaces and hyphens.
  */
 class TextLayoutManager {
  public:
   TextLayoutManager(const ContextContainer::Shared &contextContainer) {}
 
   /*
-   * Measures `attributedStringBox` using native text rendering infrastructure.
+   * Measures `attributedStringBox` using built-in font metrics.
    */
   TextMeasurement measure(
       AttributedStringBox attributedStringBox,
@@ -39,8 +43,8 @@ class TextLayoutManager {
       LayoutConstraints layoutConstraints) const;
 
   /*
-   * Measures lines of `attributedString` using native text rendering
-   * infrastructure.
+   * Measures lines of `attributedString` laid out in `size.width` using
+   * built-in font metrics.
    */
   LinesMeasurements measureLines(
       AttributedString attributedString,
@@ -52,6 +56,14 @@ class TextLayoutManager {
    * Is used on a native views layer to delegate text rendering to the manager.
    */
   void *getNativeTextLayoutManager() const;
+
+ private:
+  TextMeasurement doMeasure(
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      LayoutConstraints const &layoutConstraints) const;
+
+  TextMeasureCache measureCache_{};
 };
 
 } // namespace react
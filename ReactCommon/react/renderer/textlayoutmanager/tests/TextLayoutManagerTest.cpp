@@ -13,6 +13,134 @@
 
 using namespace facebook::react;
 
-TEST(TextLayoutManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+// Advances (in thousandths of em) of the built-in font.
+Float const kA = 556;
+Float const kB = 556;
+Float const kC = 500;
+Float const kD = 556;
+Float const kSpace = 278;
+
+// Line height (in em) of the built-in font.
+Float const kLineHeight = 0.905 + 0.212;
+
+AttributedString::Fragment makeFragment(std::string string) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  fragment.textAttributes.fontSize = 10;
+  return fragment;
+}
+
+AttributedString makeAttributedString(std::string string) {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment(std::move(string)));
+  return attributedString;
+}
+
+LayoutConstraints makeLayoutConstraints(Float maximumWidth) {
+  auto layoutConstraints = LayoutConstraints{};
+  layoutConstraints.maximumSize.width = maximumWidth;
+  return layoutConstraints;
+}
+
+} // namespace
+
+TEST(TextLayoutManagerTest, measuresSingleLine) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto measurement = textLayoutManager.measure(
+      AttributedStringBox{makeAttributedString("ab cd")},
+      ParagraphAttributes{},
+      makeLayoutConstraints(1000));
+
+  EXPECT_NEAR(
+      measurement.size.width, (kA + kB + kSpace + kC + kD) / 100, 0.001);
+  EXPECT_NEAR(measurement.size.height, kLineHeight * 10, 0.001);
+}
+
+TEST(TextLayoutManagerTest, breaksLinesAfterWhitespaces) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+  auto attributedString = makeAttributedString("ab cd");
+
+  auto measurement = textLayoutManager.measure(
+      AttributedStringBox{attributedString},
+      ParagraphAttributes{},
+      makeLayoutConstraints(15));
+
+  // The trailing whitespace does not contribute to the width.
+  EXPECT_NEAR(measurement.size.width, (kA + kB) / 100, 0.001);
+  EXPECT_NEAR(measurement.size.height, kLineHeight * 20, 0.001);
+
+  auto lines = textLayoutManager.measureLines(
+      attributedString, ParagraphAttributes{}, {15, 1000});
+
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[0].text, "ab ");
+  EXPECT_EQ(lines[1].text, "cd");
+  EXPECT_NEAR(lines[1].frame.origin.y, kLineHeight * 10, 0.001);
+  EXPECT_NEAR(lines[1].frame.size.width, (kC + kD) / 100, 0.001);
+}
+
+TEST(TextLayoutManagerTest, breaksLongWords) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto lines = textLayoutManager.measureLines(
+      makeAttributedString("aaaaa"), ParagraphAttributes{}, {12, 1000});
+
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_EQ(lines[0].text, "aa");
+  EXPECT_EQ(lines[1].text, "aa");
+  EXPECT_EQ(lines[2].text, "a");
+}
+
+TEST(TextLayoutManagerTest, respectsForcedLineBreaks) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto lines = textLayoutManager.measureLines(
+      makeAttributedString("ab\ncd\n"), ParagraphAttributes{}, {1000, 1000});
+
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_EQ(lines[0].text, "ab");
+  EXPECT_EQ(lines[1].text, "cd");
+  EXPECT_EQ(lines[2].text, "");
+  EXPECT_NEAR(lines[2].frame.size.height, kLineHeight * 10, 0.001);
+}
+
+TEST(TextLayoutManagerTest, respectsMaximumNumberOfLines) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+
+  auto measurement = textLayoutManager.measure(
+      AttributedStringBox{makeAttributedString("a b c d e")},
+      paragraphAttributes,
+      makeLayoutConstraints(1));
+
+  EXPECT_NEAR(measurement.size.height, kLineHeight * 20, 0.001);
+}
+
+TEST(TextLayoutManagerTest, placesAttachments) {
+  auto textLayoutManager = TextLayoutManager{nullptr};
+
+  auto attachment =
+      makeFragment(AttributedString::Fragment::AttachmentCharacter());
+  attachment.parentShadowView.layoutMetrics.frame.size = {20, 30};
+
+  auto attributedString = makeAttributedString("ab");
+  attributedString.appendFragment(attachment);
+
+  auto measurement = textLayoutManager.measure(
+      AttributedStringBox{attributedString},
+      ParagraphAttributes{},
+      makeLayoutConstraints(1000));
+
+  ASSERT_EQ(measurement.attachments.size(), 1);
+  auto const &frame = measurement.attachments[0].frame;
+  EXPECT_FALSE(measurement.attachments[0].isClipped);
+  EXPECT_NEAR(frame.origin.x, (kA + kB) / 100, 0.001);
+  EXPECT_NEAR(frame.origin.y, 0, 0.001);
+  EXPECT_NEAR(frame.size.width, 20, 0.001);
+  EXPECT_NEAR(frame.size.height, 30, 0.001);
+  EXPECT_NEAR(measurement.size.height, 30 + 0.212 * 10, 0.001);
 }
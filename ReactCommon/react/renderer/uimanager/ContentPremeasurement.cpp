@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ContentPremeasurement.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/debug/SystraceSection.h>
+
+namespace facebook::react {
+
+/*
+ * Measuring just a few nodes concurrently is not worth the synchronization.
+ */
+constexpr size_t kMinimumNumberOfItemsPerWorker = 4;
+
+namespace {
+
+struct PremeasurementItem {
+  LayoutableShadowNode const *layoutableShadowNode;
+  LayoutConstraints layoutConstraints;
+};
+
+/*
+ * Shared between the calling thread and the workers. A worker might start
+ * after all items are done (and the tree is gone); in that case it only
+ * observes that there is nothing left to do.
+ */
+struct PremeasurementWork {
+  LayoutContext layoutContext;
+  std::vector<PremeasurementItem> items;
+  std::atomic<size_t> nextItemIndex{0};
+  std::atomic<size_t> numberOfFinishedItems{0};
+  std::mutex mutex;
+  std::condition_variable finished;
+};
+
+/*
+ * Builds the constraints the layout pass is going to measure the node with,
+ * so that premeasurement populates the same measurement cache entries. Mirrors
+ * `YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector`: the height is
+ * not constrained, the layout direction is not set and the width is either
+ * exact or a maximum.
+ */
+void addItem(
+    std::vector<PremeasurementItem> &items,
+    LayoutableShadowNode const &layoutableShadowNode,
+    Float width,
+    bool isExactWidth) {
+  if (!(width > 0)) {
+    return;
+  }
+
+  auto layoutConstraints = LayoutConstraints{
+      {isExactWidth ? width : 0, 0},
+      {width, std::numeric_limits<Float>::infinity()}};
+  items.push_back({&layoutableShadowNode, layoutConstraints});
+}
+
+void collectItems(
+    ShadowNode const &shadowNode,
+    Float availableWidth,
+    std::vector<PremeasurementItem> &items) {
+  for (auto const &childNode : shadowNode.getChildren()) {
+    auto layoutableChildNode =
+        traitCast<LayoutableShadowNode const *>(childNode.get());
+
+    // Clean nodes have clean subtrees.
+    if (!layoutableChildNode || layoutableChildNode->getIsLayoutClean()) {
+      continue;
+    }
+
+    auto layoutMetrics = layoutableChildNode->getLayoutMetrics();
+    auto isLaidOut = layoutMetrics != EmptyLayoutMetrics;
+    auto contentWidth = layoutMetrics.getContentFrame().size.width;
+
+    if (childNode->getTraits().check(
+            ShadowNodeTraits::Trait::MeasurableYogaNode)) {
+      if (isLaidOut) {
+        // Stretched nodes (and nodes with a fixed width) are measured with
+        // exactly their own width; the final layout of other nodes does that
+        // too.
+        addItem(items, *layoutableChildNode, contentWidth, true);
+
+        // Other nodes are first measured with at most the width available in
+        // the parent.
+        auto insets = layoutMetrics.contentInsets;
+        auto width = availableWidth - insets.left - insets.right;
+        if (width != contentWidth) {
+          addItem(items, *layoutableChildNode, width, false);
+        }
+      } else {
+        addItem(items, *layoutableChildNode, availableWidth, false);
+      }
+    }
+
+    collectItems(*childNode, isLaidOut ? contentWidth : availableWidth, items);
+  }
+}
+
+void performItems(PremeasurementWork &work) {
+  auto numberOfItems = work.items.size();
+
+  while (true) {
+    auto index = work.nextItemIndex.fetch_add(1);
+    if (index >= numberOfItems) {
+      return;
+    }
+
+    auto const &item = work.items[index];
+    item.layoutableShadowNode->premeasureContent(
+        work.layoutContext, item.layoutConstraints);
+
+    if (work.numberOfFinishedItems.fetch_add(1) + 1 == numberOfItems) {
+      std::lock_guard<std::mutex> lock(work.mutex);
+      work.finished.notify_all();
+    }
+  }
+}
+
+} // namespace
+
+void premeasureContent(
+    RootShadowNode const &rootShadowNode,
+    BackgroundExecutor const &backgroundExecutor,
+    size_t maximumNumberOfWorkers) {
+  SystraceSection s("premeasureContent");
+
+  if (!backgroundExecutor || maximumNumberOfWorkers == 0 ||
+      rootShadowNode.getIsLayoutClean()) {
+    return;
+  }
+
+  auto const &props = rootShadowNode.getConcreteProps();
+
+  auto work = std::make_shared<PremeasurementWork>();
+  work->layoutContext = props.layoutContext;
+
+  auto rootLayoutMetrics = rootShadowNode.getLayoutMetrics();
+  auto availableWidth = rootLayoutMetrics != EmptyLayoutMetrics
+      ? rootLayoutMetrics.getContentFrame().size.width
+      : props.layoutConstraints.maximumSize.width;
+
+  collectItems(rootShadowNode, availableWidth, work->items);
+
+  auto numberOfWorkers = std::min(
+      maximumNumberOfWorkers,
+      work->items.size() / kMinimumNumberOfItemsPerWorker);
+
+  if (numberOfWorkers == 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < numberOfWorkers; i++) {
+    backgroundExecutor([work]() { performItems(*work); });
+  }
+
+  // The calling thread participates as well, so the work gets done even if
+  // the workers start late (e.g. if the executor is busy or serial).
+  performItems(*work);
+
+  // Waiting for items which are still being measured by the workers: the
+  // layout pass is going to mutate the nodes.
+  std::unique_lock<std::mutex> lock(work->mutex);
+  work->finished.wait(lock, [&]() {
+    return work->numberOfFinishedItems == work->items.size();
+  });
+}
+
+} // namespace facebook::react
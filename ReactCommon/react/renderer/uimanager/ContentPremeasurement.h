@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/uimanager/primitives.h>
+
+namespace facebook::react {
+
+/*
+ * Calls `LayoutableShadowNode::premeasureContent` for every dirty measurable
+ * node of the tree (e.g. paragraphs with changed text), so the following
+ * layout pass (which measures such nodes one by one) mostly hits measurement
+ * caches.
+ * The nodes are measured concurrently on the calling thread and on up to
+ * `maximumNumberOfWorkers` tasks scheduled on `backgroundExecutor`, so the
+ * text layout manager of the platform must support concurrent measurement.
+ * The width constraints are guessed from the layout of the previous revision
+ * (exactly the node's own width, and at most the width available in the
+ * closest laid out ancestor) and are built like the ones Yoga measures with.
+ * Returns after all measurements are finished.
+ */
+void premeasureContent(
+    RootShadowNode const &rootShadowNode,
+    BackgroundExecutor const &backgroundExecutor,
+    size_t maximumNumberOfWorkers);
+
+} // namespace facebook::react
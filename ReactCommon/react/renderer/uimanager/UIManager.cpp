@@ -12,12 +12,14 @@
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <react/renderer/graphics/Geometry.h>
+#include <react/renderer/uimanager/ContentPremeasurement.h>
 #include <react/renderer/uimanager/SurfaceRegistryBinding.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/UIManagerCommitHook.h>
 
 #include <glog/logging.h>
 
+#include <thread>
 #include <utility>
 
 namespace facebook::react {
@@ -156,6 +158,94 @@ void UIManager::completeSurface(
   });
 }
 
+void UIManager::completeSurfaceAsynchronously(
+    SurfaceId surfaceId,
+    ShadowNode::UnsharedListOfWeak const &rootChildren) const {
+  auto shouldSchedule = false;
+
+  {
+    std::lock_guard<std::mutex> lock(pendingSurfaceCompletionsMutex_);
+
+    // If there is an entry for the surface already, some background task is
+    // already scheduled (or running) and will pick up the newest children.
+    shouldSchedule = pendingSurfaceCompletions_.find(surfaceId) ==
+        pendingSurfaceCompletions_.end();
+
+    auto &pendingCompletion = pendingSurfaceCompletions_[surfaceId];
+    pendingCompletion.rootChildren = rootChildren;
+    pendingCompletion.number = ++surfaceCompletionCounter_;
+  }
+
+  if (!shouldSchedule) {
+    return;
+  }
+
+  auto weakUIManager = weak_from_this();
+  if (!backgroundExecutor_ || weakUIManager.expired()) {
+    commitPendingSurfaceCompletions(surfaceId);
+    return;
+  }
+
+  backgroundExecutor_([weakUIManager, surfaceId] {
+    auto uiManager = weakUIManager.lock();
+    if (uiManager) {
+      uiManager->commitPendingSurfaceCompletions(surfaceId);
+    }
+  });
+}
+
+void UIManager::commitPendingSurfaceCompletions(SurfaceId surfaceId) const {
+  SystraceSection s("UIManager::commitPendingSurfaceCompletions");
+
+  while (true) {
+    auto weakRootChildren = ShadowNode::UnsharedListOfWeak{};
+    auto number = uint64_t{0};
+
+    {
+      std::lock_guard<std::mutex> lock(pendingSurfaceCompletionsMutex_);
+
+      auto iterator = pendingSurfaceCompletions_.find(surfaceId);
+      if (iterator == pendingSurfaceCompletions_.end()) {
+        // The surface was stopped.
+        return;
+      }
+
+      if (!iterator->second.rootChildren) {
+        // Nothing newer arrived since the last commit.
+        pendingSurfaceCompletions_.erase(iterator);
+        return;
+      }
+
+      // Moving out leaves `nullptr` which marks the children as picked up.
+      weakRootChildren = std::move(iterator->second.rootChildren);
+      number = iterator->second.number;
+    }
+
+    auto rootChildren = shadowNodeListFromWeakList(weakRootChildren);
+    if (!rootChildren) {
+      continue;
+    }
+
+    completeSurface(
+        surfaceId,
+        rootChildren,
+        {/* .enableStateReconciliation = */ true,
+         /* .shouldYield = */ [this, surfaceId, number]() {
+           return isSurfaceCompletionSuperseded(surfaceId, number);
+         }});
+  }
+}
+
+bool UIManager::isSurfaceCompletionSuperseded(
+    SurfaceId surfaceId,
+    uint64_t number) const {
+  std::lock_guard<std::mutex> lock(pendingSurfaceCompletionsMutex_);
+
+  auto iterator = pendingSurfaceCompletions_.find(surfaceId);
+  return iterator != pendingSurfaceCompletions_.end() &&
+      iterator->second.number > number;
+}
+
 void UIManager::setIsJSResponder(
     ShadowNode::Shared const &shadowNode,
     bool isJSResponder,
@@ -202,6 +292,12 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   // Stop any ongoing animations.
   stopSurfaceForAnimationDelegate(surfaceId);
 
+  // Dropping pending asynchronous commits.
+  {
+    std::lock_guard<std::mutex> lock(pendingSurfaceCompletionsMutex_);
+    pendingSurfaceCompletions_.erase(surfaceId);
+  }
+
   // Waiting for all concurrent commits to be finished and unregistering the
   // `ShadowTree`.
   auto shadowTree = getShadowTreeRegistry().remove(surfaceId);
@@ -419,6 +515,24 @@ RootShadowNode::Unshared UIManager::shadowTreeWillCommit(
   return resultRootShadowNode;
 }
 
+void UIManager::shadowTreeWillLayout(
+    ShadowTree const &shadowTree,
+    RootShadowNode const &rootShadowNode) const {
+  if (!contentPremeasurementEnabled_) {
+    return;
+  }
+
+  auto numberOfCores = std::thread::hardware_concurrency();
+  premeasureContent(
+      rootShadowNode,
+      backgroundExecutor_,
+      numberOfCores > 1 ? numberOfCores - 1 : 0);
+}
+
+void UIManager::setContentPremeasurementEnabled(bool enabled) {
+  contentPremeasurementEnabled_ = enabled;
+}
+
 void UIManager::shadowTreeDidFinishTransaction(
     ShadowTree const &shadowTree,
     MountingCoordinator::Shared const &mountingCoordinator) const {
@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 
@@ -30,7 +34,8 @@ namespace facebook::react {
 class UIManagerBinding;
 class UIManagerCommitHook;
 
-class UIManager final : public ShadowTreeDelegate {
+class UIManager final : public ShadowTreeDelegate,
+                        public std::enable_shared_from_this<UIManager> {
  public:
   UIManager(
       RuntimeExecutor const &runtimeExecutor,
@@ -111,6 +116,17 @@ class UIManager final : public ShadowTreeDelegate {
       RootShadowNode::Shared const &oldRootShadowNode,
       RootShadowNode::Unshared const &newRootShadowNode) const override;
 
+  void shadowTreeWillLayout(
+      ShadowTree const &shadowTree,
+      RootShadowNode const &rootShadowNode) const override;
+
+  /*
+   * Enables measuring content of dirty nodes concurrently (on the background
+   * executor) before every layout pass. See `premeasureContent`.
+   * Must be called before any surface is started.
+   */
+  void setContentPremeasurementEnabled(bool enabled);
+
   ShadowNode::Shared createNode(
       Tag tag,
       std::string const &componentName,
@@ -132,6 +148,18 @@ class UIManager final : public ShadowTreeDelegate {
       ShadowNode::UnsharedListOfShared const &rootChildren,
       ShadowTree::CommitOptions commitOptions) const;
 
+  /*
+   * Pipelined version of `completeSurface`: the commit (including layout,
+   * diffing and mounting preparation) happens on the background executor.
+   * Newer calls for the same surface supersede older ones: a pending commit
+   * is dropped before it does any work and an in-flight one yields before
+   * committing.
+   * Can be called on any thread.
+   */
+  void completeSurfaceAsynchronously(
+      SurfaceId surfaceId,
+      ShadowNode::UnsharedListOfWeak const &rootChildren) const;
+
   void setIsJSResponder(
       ShadowNode::Shared const &shadowNode,
       bool isJSResponder,
@@ -183,6 +211,33 @@ class UIManager final : public ShadowTreeDelegate {
       jsi::Value const &successCallback,
       jsi::Value const &failureCallback) const;
 
+  /*
+   * Commits the most recent pending children of the surface (scheduled via
+   * `completeSurfaceAsynchronously`) until there are no newer ones.
+   * Called on the background executor.
+   */
+  void commitPendingSurfaceCompletions(SurfaceId surfaceId) const;
+
+  /*
+   * Returns `true` if there is a newer pending completion for the surface
+   * than the one with given `number`.
+   */
+  bool isSurfaceCompletionSuperseded(SurfaceId surfaceId, uint64_t number)
+      const;
+
+  struct PendingSurfaceCompletion {
+    /*
+     * The most recent children which were not picked up for committing yet
+     * (or `nullptr` if there are none).
+     */
+    ShadowNode::UnsharedListOfWeak rootChildren;
+
+    /*
+     * The number of the most recent completion (unique across surfaces).
+     */
+    uint64_t number{0};
+  };
+
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   UIManagerDelegate *delegate_;
   UIManagerAnimationDelegate *animationDelegate_{nullptr};
@@ -191,10 +246,18 @@ class UIManager final : public ShadowTreeDelegate {
   BackgroundExecutor const backgroundExecutor_{};
   ContextContainer::Shared contextContainer_;
 
+  bool contentPremeasurementEnabled_{false};
+
   mutable butter::shared_mutex commitHookMutex_;
   mutable std::vector<UIManagerCommitHook const *> commitHooks_;
 
   std::unique_ptr<LeakChecker> leakChecker_;
+
+  mutable std::mutex pendingSurfaceCompletionsMutex_;
+  mutable std::unordered_map<SurfaceId, PendingSurfaceCompletion>
+      pendingSurfaceCompletions_; // Protected by `pendingSurfaceCompletionsMutex_`.
+  mutable uint64_t surfaceCompletionCounter_{
+      0}; // Protected by `pendingSurfaceCompletionsMutex_`.
 };
 
 } // namespace facebook::react
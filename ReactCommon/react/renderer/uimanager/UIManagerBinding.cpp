@@ -68,8 +68,7 @@ UIManagerBinding::~UIManagerBinding() {
 jsi::Value UIManagerBinding::getInspectorDataForInstance(
     jsi::Runtime &runtime,
     EventEmitter const &eventEmitter) const {
-  auto eventTarget = eventEmitter.eventTarget_;
-  EventEmitter::DispatchMutex().lock();
+  auto eventTarget = eventEmitter.getEventTarget();
 
   if (!runtime.global().hasProperty(runtime, "__fbBatchedBridge") ||
       !eventTarget) {
@@ -79,7 +78,6 @@ jsi::Value UIManagerBinding::getInspectorDataForInstance(
   eventTarget->retain(runtime);
   auto instanceHandle = eventTarget->getInstanceHandle(runtime);
   eventTarget->release(runtime);
-  EventEmitter::DispatchMutex().unlock();
 
   if (instanceHandle.isUndefined()) {
     return jsi::Value::undefined();
@@ -140,6 +138,97 @@ void UIManagerBinding::dispatchEvent(
   currentEventPriority_ = ReactEventPriority::Default;
 }
 
+/*
+ * Packed event payloads, moved into an `ArrayBuffer` without copying.
+ */
+class PackedPayloadBuffer : public jsi::MutableBuffer {
+ public:
+  explicit PackedPayloadBuffer(std::vector<double> values)
+      : values_(std::move(values)) {}
+
+  size_t size() const override {
+    return values_.size() * sizeof(double);
+  }
+
+  uint8_t *data() override {
+    return reinterpret_cast<uint8_t *>(values_.data());
+  }
+
+ private:
+  std::vector<double> values_;
+};
+
+void UIManagerBinding::dispatchPackedEvents(
+    jsi::Runtime &runtime,
+    std::string const &type,
+    ReactEventPriority priority,
+    std::vector<RawEvent const *> const &events) const {
+  if (!packedEventHandler_) {
+    for (auto event : events) {
+      dispatchEvent(
+          runtime,
+          event->eventTarget.get(),
+          type,
+          priority,
+          event->payloadFactory);
+    }
+    return;
+  }
+
+  SystraceSection s("UIManagerBinding::dispatchPackedEvents", "type", type);
+
+  auto instanceHandles = std::vector<jsi::Value>{};
+  instanceHandles.reserve(events.size());
+  auto records = std::vector<double>{};
+
+  for (auto event : events) {
+    auto recordStart = records.size();
+    auto eventTarget = event->eventTarget.get();
+    records.push_back(eventTarget ? eventTarget->getTag() : 0);
+
+    // If a payload is not packed, the factory has decided to cancel the
+    // event.
+    if (!event->packedPayloadFactory(records)) {
+      records.resize(recordStart);
+      continue;
+    }
+
+    auto instanceHandle = eventTarget
+        ? eventTarget->getInstanceHandle(runtime)
+        : jsi::Value::null();
+    if (instanceHandle.isNull() || instanceHandle.isUndefined()) {
+      LOG(WARNING) << "instanceHandle is null, event will be dropped";
+      records.resize(recordStart);
+      continue;
+    }
+
+    instanceHandles.push_back(std::move(instanceHandle));
+  }
+
+  if (instanceHandles.empty()) {
+    return;
+  }
+
+  auto instanceHandleArray = jsi::Array(runtime, instanceHandles.size());
+  for (size_t i = 0; i < instanceHandles.size(); i++) {
+    instanceHandleArray.setValueAtIndex(
+        runtime, i, std::move(instanceHandles[i]));
+  }
+
+  auto &packedEventHandlerWrapper =
+      static_cast<EventHandlerWrapper const &>(*packedEventHandler_);
+
+  currentEventPriority_ = priority;
+  packedEventHandlerWrapper.callback.call(
+      runtime,
+      {jsi::String::createFromUtf8(runtime, type),
+       std::move(instanceHandleArray),
+       jsi::ArrayBuffer(
+           runtime,
+           std::make_shared<PackedPayloadBuffer>(std::move(records)))});
+  currentEventPriority_ = ReactEventPriority::Default;
+}
+
 void UIManagerBinding::invalidate() const {
   uiManager_->setDelegate(nullptr);
 }
@@ -261,13 +350,15 @@ jsi::Value UIManagerBinding::get(
               arguments[3].getObject(runtime).getFunction(runtime);
           auto targetNode =
               uiManager->findNodeAtPoint(node, Point{locationX, locationY});
-          auto &eventTarget = targetNode->getEventEmitter()->eventTarget_;
+          auto eventTarget =
+              targetNode->getEventEmitter()->getEventTarget();
 
-          EventEmitter::DispatchMutex().lock();
-          eventTarget->retain(runtime);
-          auto instanceHandle = eventTarget->getInstanceHandle(runtime);
-          eventTarget->release(runtime);
-          EventEmitter::DispatchMutex().unlock();
+          auto instanceHandle = jsi::Value::null();
+          if (eventTarget) {
+            eventTarget->retain(runtime);
+            instanceHandle = eventTarget->getInstanceHandle(runtime);
+            eventTarget->release(runtime);
+          }
 
           onSuccessFunction.call(runtime, std::move(instanceHandle));
           return jsi::Value::undefined();
@@ -384,14 +475,13 @@ jsi::Value UIManagerBinding::get(
   }
 
   if (methodName == "completeRoot") {
-    std::weak_ptr<UIManager> weakUIManager = uiManager_;
     // Enhanced version of the method that uses `backgroundExecutor` and
     // captures a shared pointer to `UIManager`.
     return jsi::Function::createFromHostFunction(
         runtime,
         name,
         2,
-        [weakUIManager, uiManager](
+        [uiManager](
             jsi::Runtime &runtime,
             jsi::Value const &thisValue,
             jsi::Value const *arguments,
@@ -410,32 +500,10 @@ jsi::Value UIManagerBinding::get(
               uiManager->completeSurface(surfaceId, shadowNodeList, {true});
             }
           } else {
-            auto weakShadowNodeList =
-                weakShadowNodeListFromValue(runtime, arguments[1]);
-            static std::atomic_uint_fast8_t completeRootEventCounter{0};
-            static std::atomic_uint_fast32_t mostRecentSurfaceId{0};
-            completeRootEventCounter += 1;
-            mostRecentSurfaceId = surfaceId;
-            uiManager->backgroundExecutor_(
-                [weakUIManager,
-                 weakShadowNodeList,
-                 surfaceId,
-                 eventCount = completeRootEventCounter.load()] {
-                  auto shouldYield = [=]() -> bool {
-                    // If `completeRootEventCounter` was incremented, another
-                    // `completeSurface` call has been scheduled and current
-                    // `completeSurface` should yield to it.
-                    return completeRootEventCounter > eventCount &&
-                        mostRecentSurfaceId == surfaceId;
-                  };
-                  auto shadowNodeList =
-                      shadowNodeListFromWeakList(weakShadowNodeList);
-                  auto strongUIManager = weakUIManager.lock();
-                  if (shadowNodeList && strongUIManager) {
-                    strongUIManager->completeSurface(
-                        surfaceId, shadowNodeList, {true, shouldYield});
-                  }
-                });
+            // Layout, diffing and mounting preparation happen on a background
+            // thread; the JavaScript thread is released right away.
+            uiManager->completeSurfaceAsynchronously(
+                surfaceId, weakShadowNodeListFromValue(runtime, arguments[1]));
           }
 
           return jsi::Value::undefined();
@@ -460,6 +528,24 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  if (methodName == "registerPackedEventHandler") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        1,
+        [this](
+            jsi::Runtime &runtime,
+            jsi::Value const &thisValue,
+            jsi::Value const *arguments,
+            size_t count) noexcept -> jsi::Value {
+          auto packedEventHandler =
+              arguments[0].getObject(runtime).getFunction(runtime);
+          packedEventHandler_ = std::make_unique<EventHandlerWrapper>(
+              std::move(packedEventHandler));
+          return jsi::Value::undefined();
+        });
+  }
+
   if (methodName == "getRelativeLayoutMetrics") {
     return jsi::Function::createFromHostFunction(
         runtime,
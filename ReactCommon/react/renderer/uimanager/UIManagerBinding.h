@@ -10,6 +10,7 @@
 #include <ReactCommon/RuntimeExecutor.h>
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
+#include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/RawValue.h>
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/primitives.h>
@@ -58,6 +59,22 @@ class UIManagerBinding : public jsi::HostObject {
       ReactEventPriority priority,
       ValueFactory const &payloadFactory) const;
 
+  /*
+   * Delivers events of the same type which have packed payloads (e.g. the
+   * `layout` events of a commit) to JavaScript in a single call to the
+   * handler registered via `registerPackedEventHandler`, or one by one via
+   * `dispatchEvent` if there is no such handler.
+   * The handler gets the type, an array of instance handles and an
+   * `ArrayBuffer` of as many records of doubles: the tag of the target
+   * followed by the packed payload of the event.
+   * Thread synchronization must be enforced externally.
+   */
+  void dispatchPackedEvents(
+      jsi::Runtime &runtime,
+      std::string const &type,
+      ReactEventPriority priority,
+      std::vector<RawEvent const *> const &events) const;
+
   /*
    * Invalidates the binding and underlying UIManager.
    * Allows to save some resources and prevents UIManager's delegate to be
@@ -75,6 +92,7 @@ class UIManagerBinding : public jsi::HostObject {
  private:
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<EventHandler const> eventHandler_;
+  std::unique_ptr<EventHandler const> packedEventHandler_;
   mutable ReactEventPriority currentEventPriority_;
 
   RuntimeExecutor runtimeExecutor_;
@@ -5,13 +5,164 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/uimanager/UIManager.h>
 
 using namespace facebook::react;
 
-TEST(UIManagerTest, testSomething) {
-  // TODO
+class UIManagerTest : public testing::Test {
+ protected:
+  UIManagerTest() {
+    uiManager_ = std::make_shared<UIManager>(
+        [](auto &&) {},
+        [this](std::function<void()> &&task) {
+          backgroundTasks_.push_back(std::move(task));
+        },
+        contextContainer_);
+    uiManager_->setDelegate(nullptr);
+
+    uiManager_->startSurface(
+        std::make_unique<ShadowTree>(
+            surfaceId_,
+            LayoutConstraints{},
+            LayoutContext{},
+            *uiManager_,
+            *contextContainer_),
+        "UIManagerTest",
+        folly::dynamic::object(),
+        DisplayMode::Visible);
+  }
+
+  ~UIManagerTest() override {
+    // `ShadowTreeRegistry` must be empty when `UIManager` is deallocated.
+    uiManager_->stopSurface(surfaceId_);
+  }
+
+  ShadowNode::Shared makeNode(Tag tag) const {
+    auto parserContext = PropsParserContext{surfaceId_, *contextContainer_};
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{viewComponentDescriptor_.cloneProps(
+            parserContext, nullptr, RawProps{})},
+        viewComponentDescriptor_.createFamily(
+            {tag, surfaceId_, nullptr}, nullptr));
+  }
+
+  static ShadowNode::UnsharedListOfWeak weakListFromShadowNodeList(
+      ShadowNode::ListOfShared const &shadowNodeList) {
+    auto weakList = std::make_shared<ShadowNode::ListOfWeak>();
+    for (auto const &shadowNode : shadowNodeList) {
+      weakList->push_back(shadowNode);
+    }
+    return weakList;
+  }
+
+  void runBackgroundTasks() {
+    while (!backgroundTasks_.empty()) {
+      auto tasks = std::move(backgroundTasks_);
+      backgroundTasks_.clear();
+      for (auto const &task : tasks) {
+        task();
+      }
+    }
+  }
+
+  std::vector<Tag> committedTags() const {
+    auto tags = std::vector<Tag>{};
+    uiManager_->getShadowTreeRegistry().visit(
+        surfaceId_, [&](ShadowTree const &shadowTree) {
+          auto const &rootShadowNode =
+              shadowTree.getCurrentRevision().rootShadowNode;
+          for (auto const &child : rootShadowNode->getChildren()) {
+            tags.push_back(child->getTag());
+          }
+        });
+    return tags;
+  }
+
+  SurfaceId const surfaceId_{1};
+  ContextContainer::Shared contextContainer_{
+      std::make_shared<ContextContainer>()};
+  ViewComponentDescriptor const viewComponentDescriptor_{
+      ComponentDescriptorParameters{
+          EventDispatcher::Shared{}, contextContainer_, nullptr}};
+  std::vector<std::function<void()>> backgroundTasks_{};
+  std::shared_ptr<UIManager> uiManager_;
+};
+
+TEST_F(UIManagerTest, completesSurfaceAsynchronously) {
+  auto childA = makeNode(10);
+  auto childB = makeNode(11);
+  auto childC = makeNode(12);
+
+  uiManager_->completeSurfaceAsynchronously(
+      surfaceId_, weakListFromShadowNodeList({childA}));
+  uiManager_->completeSurfaceAsynchronously(
+      surfaceId_, weakListFromShadowNodeList({childB, childC}));
+
+  // Both completions share one background task and nothing is committed
+  // before it runs.
+  EXPECT_EQ(backgroundTasks_.size(), 1);
+  EXPECT_TRUE(committedTags().empty());
+
+  runBackgroundTasks();
+
+  // Only the newest children are committed.
+  EXPECT_EQ(committedTags(), (std::vector<Tag>{11, 12}));
+
+  // Once the task is done, the next completion schedules a new one.
+  uiManager_->completeSurfaceAsynchronously(
+      surfaceId_, weakListFromShadowNodeList({childA}));
+  EXPECT_EQ(backgroundTasks_.size(), 1);
+
+  runBackgroundTasks();
+
+  EXPECT_EQ(committedTags(), (std::vector<Tag>{10}));
+}
+
+TEST_F(UIManagerTest, skipsAsynchronousCompletionOfDeallocatedChildren) {
+  auto childA = makeNode(10);
+
+  uiManager_->completeSurfaceAsynchronously(
+      surfaceId_, weakListFromShadowNodeList({childA}));
+  childA.reset();
+
+  runBackgroundTasks();
+
+  EXPECT_TRUE(committedTags().empty());
+}
+
+TEST_F(UIManagerTest, dropsQueuedCompletionOfStoppedSurface) {
+  auto childA = makeNode(10);
+
+  uiManager_->completeSurfaceAsynchronously(
+      surfaceId_, weakListFromShadowNodeList({childA}));
+  EXPECT_EQ(backgroundTasks_.size(), 1);
+
+  auto shadowTree = uiManager_->stopSurface(surfaceId_);
+  ASSERT_NE(shadowTree, nullptr);
+
+  // A surface started again with the same id before the task runs must not
+  // receive the completion queued for the stopped one.
+  uiManager_->startSurface(
+      std::make_unique<ShadowTree>(
+          surfaceId_,
+          LayoutConstraints{},
+          LayoutContext{},
+          *uiManager_,
+          *contextContainer_),
+      "UIManagerTest",
+      folly::dynamic::object(),
+      DisplayMode::Visible);
+
+  runBackgroundTasks();
+
+  EXPECT_TRUE(committedTags().empty());
+  EXPECT_TRUE(
+      shadowTree->getCurrentRevision().rootShadowNode->getChildren().empty());
 }
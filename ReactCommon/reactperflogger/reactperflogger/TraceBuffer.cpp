@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TraceBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace facebook {
+namespace react {
+namespace TraceBuffer {
+
+namespace {
+
+constexpr size_t kTagWords = 4;
+constexpr size_t kTagSize = kTagWords * sizeof(uint64_t);
+
+/*
+ * A slot of the ring buffer. The owning thread overwrites slots while other
+ * threads may read them, so every field is an atomic accessed with relaxed
+ * ordering (plain loads and stores on common architectures), and `sequence`
+ * makes the slot a seqlock: it is odd while event `index` is being written and
+ * `2 * (index + 1)` once it is complete. A reader keeps a copy only if it saw
+ * that value both before and after copying.
+ */
+struct Event {
+  std::atomic<uint64_t> sequence{0};
+  // In ticks, see `readTicks()`.
+  std::atomic<uint64_t> timestamp{0};
+  std::atomic<const char *> name{nullptr};
+  std::atomic<EventType> type{EventType::Marker};
+  // Null-terminated, stored as words so that it can be copied without
+  // `strncpy` (which pads the whole tag) or byte-wise atomics.
+  std::array<std::atomic<uint64_t>, kTagWords> tag{};
+};
+
+/*
+ * A copy of an event, taken by `readEvents()`.
+ */
+struct EventData {
+  uint64_t timestamp;
+  const char *name;
+  EventType type;
+  char tag[kTagSize];
+};
+
+static_assert(sizeof(Event) == 64, "Event must fit in a cache line");
+static_assert(
+    (kEventsPerThread & (kEventsPerThread - 1)) == 0,
+    "kEventsPerThread must be a power of two");
+
+/*
+ * Single-producer ring buffer, written only by the thread it belongs to.
+ * `head` is the number of events written so far; event `i` is stored at
+ * `events[i % kEventsPerThread]`.
+ */
+struct ThreadBuffer {
+  explicit ThreadBuffer(uint32_t threadId) : threadId(threadId) {}
+
+  const uint32_t threadId;
+  std::atomic<uint64_t> head{0};
+  // Events before this index were dropped by `clear()`.
+  std::atomic<uint64_t> start{0};
+  // Set when the thread exits; the buffer is released after its next dump.
+  std::atomic<bool> retired{false};
+  std::array<Event, kEventsPerThread> events;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  uint32_t nextThreadId{1};
+};
+
+Registry &getRegistry() {
+  // Leaked, so that threads exiting during static destruction can still
+  // retire their buffers.
+  static auto registry = new Registry();
+  return *registry;
+}
+
+// Trivially destructible, so that reading it does not go through the
+// thread-local wrapper function on every event.
+thread_local ThreadBuffer *t_buffer = nullptr;
+thread_local bool t_isThreadExiting = false;
+
+struct ThreadBufferHolder {
+  ~ThreadBufferHolder() {
+    t_buffer = nullptr;
+    t_isThreadExiting = true;
+    if (buffer) {
+      buffer->retired.store(true, std::memory_order_release);
+    }
+  }
+
+  std::shared_ptr<ThreadBuffer> buffer;
+};
+
+thread_local ThreadBufferHolder t_bufferHolder;
+
+ThreadBuffer *createThreadBuffer() {
+  if (t_isThreadExiting) {
+    return nullptr;
+  }
+  auto &registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto buffer = std::make_shared<ThreadBuffer>(registry.nextThreadId++);
+  registry.buffers.push_back(buffer);
+  t_bufferHolder.buffer = buffer;
+  return buffer.get();
+}
+
+uint64_t steadyClockNanoseconds() noexcept {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+/*
+ * Reading the CPU counter directly is cheaper than `steady_clock::now()`,
+ * which would dominate the cost of an event otherwise (compare `steadyClockNow`
+ * with the recording benchmarks in tests/benchmarks/TraceBufferBenchmark.cpp).
+ * Ticks are converted to nanoseconds when the buffer is dumped.
+ */
+uint64_t readTicks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  return steadyClockNanoseconds();
+#endif
+}
+
+/*
+ * A point in time in both ticks and `steady_clock` nanoseconds, used to
+ * convert the ticks of the events.
+ */
+struct ClockSample {
+  uint64_t ticks;
+  uint64_t nanoseconds;
+
+  static ClockSample now() noexcept {
+    return {readTicks(), steadyClockNanoseconds()};
+  }
+};
+
+// Taken when recording is enabled; guarded by the registry mutex.
+ClockSample g_enabledClockSample = ClockSample::now();
+
+class TicksConverter {
+ public:
+  TicksConverter(ClockSample start, ClockSample end) : start_(start) {
+    if (end.ticks > start.ticks && end.nanoseconds > start.nanoseconds) {
+      nanosecondsPerTick_ =
+          static_cast<double>(end.nanoseconds - start.nanoseconds) /
+          static_cast<double>(end.ticks - start.ticks);
+    }
+  }
+
+  double toMicroseconds(uint64_t ticks) const {
+    auto nanoseconds = static_cast<double>(start_.nanoseconds) +
+        (static_cast<double>(ticks) - static_cast<double>(start_.ticks)) *
+            nanosecondsPerTick_;
+    return nanoseconds / 1000;
+  }
+
+ private:
+  ClockSample start_;
+  double nanosecondsPerTick_{1};
+};
+
+/*
+ * Copies the events of `buffer` which were not overwritten while being read.
+ */
+std::vector<EventData> readEvents(const ThreadBuffer &buffer) {
+  auto head = buffer.head.load(std::memory_order_acquire);
+  auto first = std::max(
+      head > kEventsPerThread ? head - kEventsPerThread : 0,
+      buffer.start.load(std::memory_order_relaxed));
+
+  std::vector<EventData> events;
+  events.reserve(head - first);
+  for (auto index = first; index < head; index++) {
+    const auto &event = buffer.events[index % kEventsPerThread];
+    auto sequence = 2 * (index + 1);
+    if (event.sequence.load(std::memory_order_acquire) != sequence) {
+      continue;
+    }
+
+    auto data = EventData{};
+    data.timestamp = event.timestamp.load(std::memory_order_relaxed);
+    data.name = event.name.load(std::memory_order_relaxed);
+    data.type = event.type.load(std::memory_order_relaxed);
+    uint64_t tag[kTagWords];
+    for (size_t i = 0; i < kTagWords; i++) {
+      tag[i] = event.tag[i].load(std::memory_order_relaxed);
+    }
+    memcpy(data.tag, tag, kTagSize);
+    data.tag[kTagSize - 1] = '\0';
+
+    // The owning thread may have started to overwrite the slot while it was
+    // being copied.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (event.sequence.load(std::memory_order_relaxed) != sequence) {
+      continue;
+    }
+    events.push_back(data);
+  }
+  return events;
+}
+
+void appendJsonString(std::string &json, const char *string) {
+  json += '"';
+  for (auto character = string; *character != '\0'; character++) {
+    auto c = static_cast<unsigned char>(*character);
+    if (c == '"' || c == '\\') {
+      json += '\\';
+      json += static_cast<char>(c);
+    } else if (c < 0x20) {
+      char escaped[7];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      json += escaped;
+    } else {
+      json += static_cast<char>(c);
+    }
+  }
+  json += '"';
+}
+
+void appendJsonEvent(
+    std::string &json,
+    const TicksConverter &ticksConverter,
+    uint32_t threadId,
+    const EventData &event) {
+  const char *phase = event.type == EventType::SectionBegin ? "B"
+      : event.type == EventType::SectionEnd                 ? "E"
+                                                            : "i";
+  char fields[96];
+  snprintf(
+      fields,
+      sizeof(fields),
+      "\"ph\":\"%s\",\"ts\":%.3f,\"pid\":0,\"tid\":%u",
+      phase,
+      ticksConverter.toMicroseconds(event.timestamp),
+      threadId);
+
+  json += "{\"name\":";
+  appendJsonString(json, event.name != nullptr ? event.name : "");
+  json += ',';
+  json += fields;
+  if (event.type == EventType::Marker) {
+    json += ",\"s\":\"t\"";
+    if (event.tag[0] != '\0') {
+      json += ",\"args\":{\"tag\":";
+      appendJsonString(json, event.tag);
+      json += '}';
+    }
+  }
+  json += '}';
+}
+
+} // namespace
+
+namespace detail {
+
+std::atomic<bool> g_enabled{false};
+
+void record(EventType type, const char *name, const char *tag) noexcept {
+  auto buffer = t_buffer;
+  if (buffer == nullptr) {
+    try {
+      buffer = t_buffer = createThreadBuffer();
+    } catch (...) {
+      return;
+    }
+    if (buffer == nullptr) {
+      return;
+    }
+  }
+
+  auto index = buffer->head.load(std::memory_order_relaxed);
+  auto &event = buffer->events[index % kEventsPerThread];
+  event.sequence.store(2 * index + 1, std::memory_order_relaxed);
+  // Orders the odd sequence before the fields, see `Event`.
+  std::atomic_thread_fence(std::memory_order_release);
+
+  event.timestamp.store(readTicks(), std::memory_order_relaxed);
+  event.name.store(name, std::memory_order_relaxed);
+  event.type.store(type, std::memory_order_relaxed);
+  if (tag == nullptr) {
+    event.tag[0].store(0, std::memory_order_relaxed);
+  } else {
+    uint64_t words[kTagWords] = {};
+    memcpy(words, tag, strnlen(tag, kTagSize - 1));
+    for (size_t i = 0; i < kTagWords; i++) {
+      event.tag[i].store(words[i], std::memory_order_relaxed);
+    }
+  }
+
+  event.sequence.store(2 * index + 2, std::memory_order_release);
+  buffer->head.store(index + 1, std::memory_order_release);
+}
+
+} // namespace detail
+
+void setEnabled(bool enabled) {
+  if (enabled && !isEnabled()) {
+    auto &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    g_enabledClockSample = ClockSample::now();
+  }
+  detail::g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::string toChromeTraceJson() {
+  auto buffers = std::vector<std::shared_ptr<ThreadBuffer>>{};
+  auto enabledClockSample = ClockSample{};
+  {
+    auto &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    buffers = registry.buffers;
+    enabledClockSample = g_enabledClockSample;
+    // Buffers of exited threads are read one last time below.
+    registry.buffers.erase(
+        std::remove_if(
+            registry.buffers.begin(),
+            registry.buffers.end(),
+            [](const auto &buffer) {
+              return buffer->retired.load(std::memory_order_acquire);
+            }),
+        registry.buffers.end());
+  }
+
+  auto ticksConverter =
+      TicksConverter{enabledClockSample, ClockSample::now()};
+
+  std::string json = "{\"traceEvents\":[";
+  bool isFirstEvent = true;
+  for (const auto &buffer : buffers) {
+    for (const auto &event : readEvents(*buffer)) {
+      if (!isFirstEvent) {
+        json += ',';
+      }
+      isFirstEvent = false;
+      appendJsonEvent(json, ticksConverter, buffer->threadId, event);
+    }
+  }
+  json += "]}";
+  return json;
+}
+
+void clear() {
+  auto &registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto &buffer : registry.buffers) {
+    buffer->start.store(
+        buffer->head.load(std::memory_order_acquire),
+        std::memory_order_relaxed);
+  }
+}
+
+} // namespace TraceBuffer
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * In-process, always-available tracing of `SystraceSection` scopes (when
+ * built with `WITH_TRACE_BUFFER`) and `ReactMarker` events.
+ *
+ * Every thread records into its own fixed-size ring buffer, so recording
+ * takes no locks and does not allocate (except for the first event of a
+ * thread). When a ring buffer is full, the oldest events are overwritten.
+ * Recording is off by default; when it is off, the cost of an event is a
+ * relaxed atomic load.
+ */
+namespace TraceBuffer {
+
+enum class EventType : uint8_t {
+  SectionBegin,
+  SectionEnd,
+  Marker,
+};
+
+/*
+ * Number of events kept per thread.
+ */
+constexpr uint32_t kEventsPerThread = 2048;
+
+namespace detail {
+extern std::atomic<bool> g_enabled;
+void record(EventType type, const char *name, const char *tag) noexcept;
+} // namespace detail
+
+void setEnabled(bool enabled);
+
+inline bool isEnabled() noexcept {
+  return detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+/*
+ * `name` must outlive the buffer (e.g. be a string literal); `tag` is copied
+ * (and truncated to 31 characters).
+ */
+inline void beginSection(const char *name) noexcept {
+  if (isEnabled()) {
+    detail::record(EventType::SectionBegin, name, nullptr);
+  }
+}
+
+inline void endSection(const char *name) noexcept {
+  if (isEnabled()) {
+    detail::record(EventType::SectionEnd, name, nullptr);
+  }
+}
+
+inline void logMarker(const char *name, const char *tag) noexcept {
+  if (isEnabled()) {
+    detail::record(EventType::Marker, name, tag);
+  }
+}
+
+/*
+ * Returns the recorded events of all threads in the Chrome trace event format
+ * (which can be loaded in chrome://tracing or Perfetto).
+ * Can be called from any thread while events are recorded; events which are
+ * overwritten while being read are left out.
+ */
+std::string toChromeTraceJson();
+
+/*
+ * Drops the events recorded so far.
+ */
+void clear();
+
+} // namespace TraceBuffer
+
+/*
+ * Records a section in `TraceBuffer` for the lifetime of the object.
+ * Only takes string literals (or other static arrays), as the buffer keeps a
+ * pointer to the name rather than a copy.
+ */
+class TraceBufferSection {
+ public:
+  template <size_t N>
+  explicit TraceBufferSection(const char (&name)[N]) noexcept : name_(name) {
+    TraceBuffer::beginSection(name_);
+  }
+
+  ~TraceBufferSection() {
+    TraceBuffer::endSection(name_);
+  }
+
+  TraceBufferSection(const TraceBufferSection &) = delete;
+  TraceBufferSection &operator=(const TraceBufferSection &) = delete;
+
+ private:
+  const char *name_;
+};
+
+} // namespace react
+} // namespace facebook
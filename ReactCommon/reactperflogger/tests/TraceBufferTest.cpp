@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <reactperflogger/TraceBuffer.h>
+
+#include <atomic>
+#include <regex>
+#include <string>
+#include <thread>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+size_t countOccurrences(const std::string &string, const std::string &part) {
+  size_t count = 0;
+  for (auto position = string.find(part); position != std::string::npos;
+       position = string.find(part, position + part.size())) {
+    count++;
+  }
+  return count;
+}
+
+class TraceBufferTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    TraceBuffer::clear();
+    TraceBuffer::setEnabled(true);
+  }
+
+  void TearDown() override {
+    TraceBuffer::setEnabled(false);
+    TraceBuffer::clear();
+  }
+};
+
+} // namespace
+
+TEST_F(TraceBufferTest, recordsSectionsAndMarkers) {
+  {
+    TraceBufferSection section("TraceBufferTest::section");
+    TraceBuffer::logMarker("RUN_JS_BUNDLE_START", "index.\"bundle\"");
+  }
+
+  auto json = TraceBuffer::toChromeTraceJson();
+  EXPECT_EQ(0, json.find("{\"traceEvents\":["));
+  EXPECT_NE(
+      std::string::npos,
+      json.find("{\"name\":\"TraceBufferTest::section\",\"ph\":\"B\""));
+  EXPECT_NE(
+      std::string::npos,
+      json.find("{\"name\":\"TraceBufferTest::section\",\"ph\":\"E\""));
+  EXPECT_NE(
+      std::string::npos,
+      json.find("\"args\":{\"tag\":\"index.\\\"bundle\\\"\"}"));
+}
+
+TEST_F(TraceBufferTest, doesNotRecordWhenDisabled) {
+  TraceBuffer::setEnabled(false);
+  { TraceBufferSection section("TraceBufferTest::disabled"); }
+
+  EXPECT_EQ("{\"traceEvents\":[]}", TraceBuffer::toChromeTraceJson());
+}
+
+TEST_F(TraceBufferTest, keepsMostRecentEvents) {
+  for (uint32_t i = 0; i < TraceBuffer::kEventsPerThread; i++) {
+    TraceBuffer::logMarker("TraceBufferTest::old", nullptr);
+  }
+  TraceBuffer::logMarker("TraceBufferTest::new", nullptr);
+
+  // The oldest event left may be skipped, as it could be overwritten while
+  // being read.
+  auto json = TraceBuffer::toChromeTraceJson();
+  EXPECT_LE(
+      TraceBuffer::kEventsPerThread - 2,
+      countOccurrences(json, "TraceBufferTest::old"));
+  EXPECT_GE(
+      TraceBuffer::kEventsPerThread - 1,
+      countOccurrences(json, "TraceBufferTest::old"));
+  EXPECT_EQ(1, countOccurrences(json, "TraceBufferTest::new"));
+}
+
+TEST_F(TraceBufferTest, recordsEventsOfEveryThread) {
+  auto thread = std::thread(
+      [] { TraceBuffer::logMarker("TraceBufferTest::thread", nullptr); });
+  thread.join();
+  TraceBuffer::logMarker("TraceBufferTest::main", nullptr);
+
+  auto json = TraceBuffer::toChromeTraceJson();
+  EXPECT_EQ(1, countOccurrences(json, "TraceBufferTest::thread"));
+  EXPECT_EQ(1, countOccurrences(json, "TraceBufferTest::main"));
+
+  // Buffers of exited threads are released after being dumped.
+  EXPECT_EQ(
+      0,
+      countOccurrences(
+          TraceBuffer::toChromeTraceJson(), "TraceBufferTest::thread"));
+}
+
+TEST_F(TraceBufferTest, readsEventsWhileTheyAreOverwritten) {
+  auto isDone = std::atomic<bool>{false};
+  auto thread = std::thread([&] {
+    auto tagA = std::string(31, 'a');
+    auto tagB = std::string(31, 'b');
+    while (!isDone.load()) {
+      TraceBuffer::logMarker("TraceBufferTest::a", tagA.c_str());
+      TraceBuffer::logMarker("TraceBufferTest::b", tagB.c_str());
+    }
+  });
+
+  // Every event left in a dump is complete, even though its slot may be
+  // rewritten by the other thread during the dump.
+  auto event =
+      std::regex("\"TraceBufferTest::(.)\"[^}]*\"tag\":\"([^\"]*)\"");
+  for (auto i = 0; i < 100; i++) {
+    auto json = TraceBuffer::toChromeTraceJson();
+    auto end = std::sregex_iterator{};
+    for (auto match = std::sregex_iterator(json.begin(), json.end(), event);
+         match != end;
+         match++) {
+      EXPECT_EQ(std::string(31, (*match)[1].str()[0]), (*match)[2].str());
+    }
+  }
+
+  isDone.store(true);
+  thread.join();
+}
+
+} // namespace react
+} // namespace facebook
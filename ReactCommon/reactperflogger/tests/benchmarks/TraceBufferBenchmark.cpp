@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <reactperflogger/TraceBuffer.h>
+
+#include <chrono>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Cost of a section while recording is disabled (the default).
+ */
+static void traceBufferSectionDisabled(benchmark::State &state) {
+  TraceBuffer::setEnabled(false);
+  for (auto _ : state) {
+    TraceBufferSection s("traceBufferSectionDisabled");
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(traceBufferSectionDisabled);
+
+/*
+ * Cost of a recorded section (two events).
+ */
+static void traceBufferSectionEnabled(benchmark::State &state) {
+  TraceBuffer::setEnabled(true);
+  for (auto _ : state) {
+    TraceBufferSection s("traceBufferSectionEnabled");
+    benchmark::ClobberMemory();
+  }
+  TraceBuffer::setEnabled(false);
+  TraceBuffer::clear();
+}
+BENCHMARK(traceBufferSectionEnabled);
+
+/*
+ * Cost of a recorded marker with a tag (which is copied).
+ */
+static void traceBufferTaggedMarker(benchmark::State &state) {
+  TraceBuffer::setEnabled(true);
+  for (auto _ : state) {
+    TraceBuffer::logMarker("traceBufferTaggedMarker", "bundle.js");
+    benchmark::ClobberMemory();
+  }
+  TraceBuffer::setEnabled(false);
+  TraceBuffer::clear();
+}
+BENCHMARK(traceBufferTaggedMarker);
+
+/*
+ * Reference for the cost of reading the clock, which `TraceBuffer` avoids by
+ * reading the CPU counter.
+ */
+static void steadyClockNow(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+  }
+}
+BENCHMARK(steadyClockNow);
+
+/*
+ * Cost of dumping full buffers of `kEventsPerThread` events.
+ */
+static void traceBufferToChromeTraceJson(benchmark::State &state) {
+  TraceBuffer::setEnabled(true);
+  for (uint32_t i = 0; i < TraceBuffer::kEventsPerThread; i++) {
+    TraceBuffer::logMarker("traceBufferToChromeTraceJson", nullptr);
+  }
+  TraceBuffer::setEnabled(false);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(TraceBuffer::toChromeTraceJson());
+  }
+  TraceBuffer::clear();
+}
+BENCHMARK(traceBufferToChromeTraceJson);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();